@@ -4,21 +4,10 @@
 #include "ui_mainwindow.h"
 #include <parseagle/library.h>
 #include <librepcb/common/fileio/fileutils.h>
-#include <librepcb/library/sym/symbol.h>
-#include <librepcb/library/pkg/footprint.h>
-#include <librepcb/library/pkg/package.h>
-#include <librepcb/library/dev/device.h>
-#include <librepcb/library/cmp/component.h>
-#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/eagleimport/converterdb.h>
-#include <librepcb/eagleimport/symbolconverter.h>
-#include <librepcb/eagleimport/packageconverter.h>
-#include <librepcb/eagleimport/devicesetconverter.h>
-#include <librepcb/eagleimport/deviceconverter.h>
-#include "polygonsimplifier.h"
+#include <librepcb/eagleimport/eaglelibraryconverter.h>
 
 namespace librepcb {
-using namespace library;
 
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent), ui(new Ui::MainWindow)
@@ -86,7 +75,13 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
         addError("Fatal Error: " % e.getMsg());
     }
 
-    eagleimport::ConverterDb db(FilePath(ui->uuidList->text()));
+    std::unique_ptr<eagleimport::ConverterDb> db;
+    try {
+        db.reset(new eagleimport::ConverterDb(FilePath(ui->uuidList->text()))); // can throw
+    } catch (const Exception& e) {
+        addError("Fatal Error: " % e.getMsg());
+        return;
+    }
 
     for (int i = 0; i < ui->input->count(); i++) {
         FilePath filepath(ui->input->item(i)->text());
@@ -95,12 +90,18 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
             continue;
         }
 
-        convertFile(type, db, filepath);
+        convertFile(type, *db, filepath);
         ui->pbarFiles->setValue(i + 1);
 
         if (mAbortConversion)
             break;
     }
+
+    try {
+        db->save(); // can throw
+    } catch (const Exception& e) {
+        addError("Fatal Error: " % e.getMsg());
+    }
 }
 
 void MainWindow::convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
@@ -160,16 +161,8 @@ bool MainWindow::convertSymbol(eagleimport::ConverterDb& db,
                                const parseagle::Symbol& symbol)
 {
     try {
-        // create symbol
-        eagleimport::SymbolConverter converter(symbol, db);
-        std::unique_ptr<Symbol> newSymbol = converter.generate();
-
-        // convert line rects to polygon rects
-        PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
-        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
-
-        // save symbol to file
-        newSymbol->saveIntoParentDirectory(FilePath(QString("%1/sym").arg(ui->output->text())));
+        eagleimport::EagleLibraryConverter::convertSymbol(symbol, db,
+            FilePath(ui->output->text())); // can throw
     } catch (const std::exception& e) {
         addError(e.what());
         return false;
@@ -182,17 +175,8 @@ bool MainWindow::convertPackage(eagleimport::ConverterDb& db,
                                 const parseagle::Package& package)
 {
     try {
-        // create package
-        eagleimport::PackageConverter converter(package, db);
-        std::unique_ptr<Package> newPackage = converter.generate();
-
-        // convert line rects to polygon rects
-        Q_ASSERT(newPackage->getFootprints().count() == 1);
-        PolygonSimplifier<Footprint> polygonSimplifier(*newPackage->getFootprints().first());
-        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
-
-        // save package to file
-        newPackage->saveIntoParentDirectory(FilePath(QString("%1/pkg").arg(ui->output->text())));
+        eagleimport::EagleLibraryConverter::convertPackage(package, db,
+            FilePath(ui->output->text())); // can throw
     } catch (const std::exception& e) {
         addError(e.what());
         return false;
@@ -205,33 +189,12 @@ bool MainWindow::convertDevice(eagleimport::ConverterDb& db,
                                const parseagle::DeviceSet& deviceSet)
 {
     try {
-        // abort if device name ends with "-US" or "-US_"
-        if (deviceSet.getName().endsWith("-US")) return false;
-        if (deviceSet.getName().endsWith("-US_")) return false;
-
-        // create component
-        eagleimport::DeviceSetConverter converter(deviceSet, db);
-        std::unique_ptr<Component> newComponent = converter.generate();
-
-        // create devices
-        foreach (const parseagle::Device& device, deviceSet.getDevices()) {
-            if (device.getPackage().isNull()) continue;
-
-            eagleimport::DeviceConverter devConverter(deviceSet, device, db);
-            std::unique_ptr<Device> newDevice = devConverter.generate();
-
-            // save device
-            newDevice->saveIntoParentDirectory(FilePath(QString("%1/dev").arg(ui->output->text())));
-        }
-
-        // save component to file
-        newComponent->saveIntoParentDirectory(FilePath(QString("%1/cmp").arg(ui->output->text())));
+        return eagleimport::EagleLibraryConverter::convertDeviceSet(deviceSet, db,
+            FilePath(ui->output->text())); // can throw
     } catch (const std::exception& e) {
         addError(e.what());
         return false;
     }
-
-    return true;
 }
 
 void MainWindow::on_inputBtn_clicked()
@@ -275,13 +238,18 @@ void MainWindow::on_btnPathsFromIni_clicked()
     FilePath inputDir(QFileDialog::getExistingDirectory(this, "Select Input Folder", mlastInputDirectory));
     if (!inputDir.isExistingDir()) return;
 
-    QSettings outputSettings(ui->uuidList->text(), QSettings::IniFormat);
+    QSet<QString> filenames;
+    try {
+        eagleimport::ConverterDb db(FilePath(ui->uuidList->text())); // can throw
+        filenames = db.getLibraryFilenames();
+    } catch (const Exception& e) {
+        QMessageBox::critical(this, "Error", e.getMsg());
+        return;
+    }
 
-    foreach (QString key, outputSettings.allKeys())
+    foreach (const QString& filename, filenames)
     {
-        key.remove(0, key.indexOf("/")+1);
-        key.remove(key.indexOf(".lbr")+4, key.length() - key.indexOf(".lbr") - 4);
-        QString filepath = inputDir.getPathTo(key).toNative();
+        QString filepath = inputDir.getPathTo(filename).toNative();
 
         bool exists = false;
         for (int i = 0; i < ui->input->count(); i++)
@@ -351,7 +319,8 @@ void MainWindow::on_toolButton_4_clicked()
 
 void MainWindow::on_uuidListBtn_clicked()
 {
-    QString file = QFileDialog::getSaveFileName(this, "Select UUID List File", ui->uuidList->text(), "*.ini");
+    QString file = QFileDialog::getSaveFileName(this, "Select UUID List File", ui->uuidList->text(),
+                                                "*.sqlite *.ini");
     if (file.isEmpty()) return;
     ui->uuidList->setText(file);
 }
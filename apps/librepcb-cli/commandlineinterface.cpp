@@ -21,15 +21,26 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "commandlineinterface.h"
 #include <librepcb/common/application.h>
 #include <librepcb/common/debug.h>
 #include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/graphics/graphicssnapshot.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/eagleimport/eaglelibraryconverter.h>
+#include <librepcb/library/libraryupgrader.h>
 #include <librepcb/project/project.h>
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/boardsnapshotbuilder.h>
 #include <librepcb/project/erc/ercmsg.h>
 #include <librepcb/project/erc/ercmsglist.h>
+#include <librepcb/project/schematics/schematic.h>
+#include <librepcb/project/schematics/schematicsnapshotbuilder.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -61,6 +72,18 @@ int CommandLineInterface::execute() noexcept
                 tr("open-project [command_options]")
             }
         },
+        {
+            "open-library", {
+                tr("Open libraries to check or upgrade all their elements."),
+                tr("open-library [command_options]")
+            }
+        },
+        {
+            "import-eagle-libraries", {
+                tr("Convert Eagle libraries into a LibrePCB library."),
+                tr("import-eagle-libraries [command_options]")
+            }
+        },
     };
 
     // Add global options
@@ -82,6 +105,25 @@ int CommandLineInterface::execute() noexcept
         QString(tr("Export schematics to given file(s). Existing files will be "
                    "overwritten. Supported file extensions: %1")).arg("pdf"),
         tr("file"));
+    QCommandLineOption exportSchematicImagesOption(
+        "export-schematic-images",
+        QString(tr("Export every schematic page as an image to given file(s). The path "
+                   "should contain the attribute %1 to get one file per page. Existing "
+                   "files will be overwritten. Supported file extensions: %2"))
+        .arg("{{PAGE}}", GraphicsSnapshot::getSupportedFileSuffixes().join(", ")),
+        tr("file"));
+    QCommandLineOption exportBoardImagesOption(
+        "export-board-images",
+        QString(tr("Export every non-empty layer of the boards as an image to given "
+                   "file(s). The path should contain the attributes %1 and %2 to get one "
+                   "file per board and layer. Existing files will be overwritten. "
+                   "Supported file extensions: %3"))
+        .arg("{{BOARD}}", "{{LAYER}}", GraphicsSnapshot::getSupportedFileSuffixes().join(", ")),
+        tr("file"));
+    QCommandLineOption imageDpiOption(
+        "image-dpi",
+        QString(tr("Resolution of exported raster images in DPI (default: %1).")).arg(300),
+        tr("dpi"), "300");
     QCommandLineOption exportPcbFabricationDataOption(
         "export-pcb-fabrication-data",
         tr("Export PCB fabrication data (Gerber/Excellon) according the fabrication "
@@ -95,6 +137,37 @@ int CommandLineInterface::execute() noexcept
         "save",
         tr("Save project before closing it (useful to upgrade file format)."));
 
+    // Define options for "open-library"
+    QCommandLineOption librarySaveOption(
+        "save",
+        tr("Save all elements (useful to upgrade the file format). Only files whose "
+           "content has changed are written."));
+
+    // Define options for "import-eagle-libraries"
+    QCommandLineOption outputOption(
+        "output",
+        tr("The directory where the converted library elements are written to. The "
+           "elements are stored in the subdirectories \"sym\", \"pkg\", \"cmp\" "
+           "and \"dev\"."),
+        tr("directory"));
+    QCommandLineOption uuidListOption(
+        "uuid-list",
+        tr("Database file (*.sqlite) which maps the Eagle element names to the UUIDs of "
+           "the converted elements. Use the same file for every import of the same "
+           "libraries to keep their UUIDs. Legacy INI files (*.ini) are migrated to a "
+           "database next to them. If not set, a file in the output directory is used."),
+        tr("file"));
+    QCommandLineOption symbolsOption(
+        "symbols",
+        tr("Convert symbols. If none of the element types is set, all types are converted."));
+    QCommandLineOption packagesOption(
+        "packages",
+        tr("Convert packages. If none of the element types is set, all types are converted."));
+    QCommandLineOption componentsOption(
+        "components",
+        tr("Convert device sets to components and devices. If none of the element types "
+           "is set, all types are converted."));
+
     // First parse to get the supplied command (ignoring errors because the parser does
     // not yet know the command-dependent options).
     parser.parse(mApp.arguments());
@@ -111,9 +184,28 @@ int CommandLineInterface::execute() noexcept
         parser.addPositionalArgument("project", tr("Path to project file (*.lpp)."));
         parser.addOption(ercOption);
         parser.addOption(exportSchematicsOption);
+        parser.addOption(exportSchematicImagesOption);
+        parser.addOption(exportBoardImagesOption);
+        parser.addOption(imageDpiOption);
         parser.addOption(exportPcbFabricationDataOption);
         parser.addOption(boardOption);
         parser.addOption(saveOption);
+    } else if (command == "open-library") {
+        parser.clearPositionalArguments();
+        parser.addPositionalArgument(command, commands[command].first, commands[command].second);
+        parser.addPositionalArgument("libraries", tr("Paths to library directories "
+                                     "(*.lplib)."), tr("libraries..."));
+        parser.addOption(librarySaveOption);
+    } else if (command == "import-eagle-libraries") {
+        parser.clearPositionalArguments();
+        parser.addPositionalArgument(command, commands[command].first, commands[command].second);
+        parser.addPositionalArgument("libraries", tr("Paths to Eagle library files (*.lbr) "
+                                     "or directories containing them."), tr("libraries..."));
+        parser.addOption(outputOption);
+        parser.addOption(uuidListOption);
+        parser.addOption(symbolsOption);
+        parser.addOption(packagesOption);
+        parser.addOption(componentsOption);
     } else if (!command.isEmpty()) {
         printErr(QString(tr("Unknown command '%1'.")).arg(command), 2);
         print(parser.helpText(), 0);
@@ -161,14 +253,51 @@ int CommandLineInterface::execute() noexcept
             print(parser.helpText(), 0);
             return 1;
         }
+        bool dpiOk = false;
+        qreal imageDpi = parser.value(imageDpiOption).toDouble(&dpiOk);
+        if ((!dpiOk) || (imageDpi <= 0)) {
+            printErr(QString(tr("Invalid resolution: '%1'")).arg(parser.value(imageDpiOption)), 2);
+            print(parser.helpText(), 0);
+            return 1;
+        }
         cmdSuccess = openProject(
             positionalArgs.value(0),                      // project filepath
             parser.isSet(ercOption),                      // run ERC
             parser.values(exportSchematicsOption),        // export schematics
+            parser.values(exportSchematicImagesOption),   // export schematic images
+            parser.values(exportBoardImagesOption),       // export board images
+            imageDpi,                                     // resolution of images
             parser.isSet(exportPcbFabricationDataOption), // export PCB fabrication data
             parser.values(boardOption),                   // boards
             parser.isSet(saveOption)                      // save project
         );
+    } else if (command == "open-library") {
+        if (positionalArgs.isEmpty()) {
+            printErr(tr("Wrong argument count."), 2);
+            print(parser.helpText(), 0);
+            return 1;
+        }
+        cmdSuccess = openLibraries(
+            positionalArgs,                     // library directories
+            parser.isSet(librarySaveOption)     // save elements
+        );
+    } else if (command == "import-eagle-libraries") {
+        if (positionalArgs.isEmpty() || (!parser.isSet(outputOption))) {
+            printErr(tr("No input libraries or no output directory specified."), 2);
+            print(parser.helpText(), 0);
+            return 1;
+        }
+        eagleimport::EagleLibraryConverter::ElementTypes types;
+        if (parser.isSet(symbolsOption)) types |= eagleimport::EagleLibraryConverter::Symbols;
+        if (parser.isSet(packagesOption)) types |= eagleimport::EagleLibraryConverter::Packages;
+        if (parser.isSet(componentsOption)) types |= eagleimport::EagleLibraryConverter::Components;
+        if (!types) types = eagleimport::EagleLibraryConverter::All;
+        cmdSuccess = importEagleLibraries(
+            positionalArgs,                     // input files/directories
+            parser.value(outputOption),         // output directory
+            parser.value(uuidListOption),       // UUID list
+            types                               // element types
+        );
     } else {
         printErr(tr("Internal failure."));
     }
@@ -186,7 +315,8 @@ int CommandLineInterface::execute() noexcept
  ****************************************************************************************/
 
 bool CommandLineInterface::openProject(const QString& projectFile, bool runErc,
-    const QStringList& exportSchematicsFiles, bool exportPcbFabricationData,
+    const QStringList& exportSchematicsFiles, const QStringList& exportSchematicImagesFiles,
+    const QStringList& exportBoardImagesFiles, qreal imageDpi, bool exportPcbFabricationData,
     const QStringList& boards, bool save) const noexcept
 {
     try {
@@ -249,10 +379,9 @@ bool CommandLineInterface::openProject(const QString& projectFile, bool runErc,
             }
         }
 
-        // Export PCB fabrication data
-        if (exportPcbFabricationData) {
-            print(tr("Export PCB fabrication data..."));
-            QList<Board*> boardList;
+        // Determine boards to export
+        QList<Board*> boardList;
+        if (exportPcbFabricationData || (!exportBoardImagesFiles.isEmpty())) {
             if (boards.isEmpty()) {
                 // export all boards
                 boardList = project.getBoards();
@@ -269,6 +398,55 @@ bool CommandLineInterface::openProject(const QString& projectFile, bool runErc,
                     }
                 }
             }
+        }
+
+        // Export schematic and board images. The content is recorded into snapshots
+        // here, but rendering and writing the files is done concurrently in worker
+        // threads. Their results are collected after all other exports are done.
+        QList<QPair<QString, QFuture<QString>>> imageJobs; // output path, error message
+        QSet<FilePath> imageFiles;
+        auto addImageJob = [&](const GraphicsSnapshot& snapshot, const QString& destStr,
+                               const AttributeProvider& attributes, const QColor& background) {
+            QString destPathStr = AttributeSubstitutor::substitute(destStr, &attributes, [&](const QString& str){
+                return FilePath::cleanFileName(str, FilePath::ReplaceSpaces | FilePath::KeepCase);
+            });
+            FilePath destPath(QFileInfo(destPathStr).absoluteFilePath());
+            if (imageFiles.contains(destPath)) {
+                printErr("  " % QString(tr("ERROR: The file '%1' would be written multiple "
+                                           "times! Please add attributes to the path."))
+                         .arg(prettyPath(destPath, destPathStr)));
+                success = false;
+                return;
+            }
+            imageFiles.insert(destPath);
+            imageJobs.append(qMakePair(prettyPath(destPath, destPathStr),
+                                       exportImage(snapshot, destPath, imageDpi, background)));
+        };
+        foreach (const QString& destStr, exportSchematicImagesFiles) {
+            print(QString(tr("Export schematic images to '%1'...")).arg(destStr));
+            foreach (const Schematic* schematic, project.getSchematics()) {
+                SchematicSnapshotBuilder builder(*schematic);
+                addImageJob(builder.build(), destStr, *schematic, Qt::white);
+            }
+        }
+        foreach (const QString& destStr, exportBoardImagesFiles) {
+            print(QString(tr("Export board images to '%1'...")).arg(destStr));
+            foreach (const Board* board, boardList) {
+                BoardSnapshotBuilder builder(*board);
+                foreach (const GraphicsLayer* layer, board->getLayerStack().getAllLayers()) {
+                    if (!layer->isEnabled()) continue;
+                    GraphicsSnapshot snapshot = builder.buildLayer(*layer);
+                    if (snapshot.isEmpty()) continue;
+                    QString layerDestStr = destStr;
+                    layerDestStr.replace("{{LAYER}}", layer->getName());
+                    addImageJob(snapshot, layerDestStr, *board, Qt::black);
+                }
+            }
+        }
+
+        // Export PCB fabrication data
+        if (exportPcbFabricationData) {
+            print(tr("Export PCB fabrication data..."));
             QHash<FilePath, int> filesCounter;
             bool filesOverwritten = false;
             foreach (const Board* board, boardList) {
@@ -290,6 +468,20 @@ bool CommandLineInterface::openProject(const QString& projectFile, bool runErc,
             }
         }
 
+        // Wait until all images are written
+        if (!imageJobs.isEmpty()) {
+            print(QString(tr("Write %1 images...")).arg(imageJobs.count()));
+            for (auto& job : imageJobs) {
+                QString error = job.second.result(); // blocks until the job is finished
+                if (error.isEmpty()) {
+                    print(QString("  => '%1'").arg(job.first));
+                } else {
+                    printErr("  " % QString(tr("ERROR: %1")).arg(error));
+                    success = false;
+                }
+            }
+        }
+
         // Save project
         if (save) {
             print(tr("Save project..."));
@@ -305,6 +497,125 @@ bool CommandLineInterface::openProject(const QString& projectFile, bool runErc,
     }
 }
 
+bool CommandLineInterface::openLibraries(const QStringList& libDirs, bool save) const noexcept
+{
+    // Note: The libraries are processed one after another, but the elements of each
+    // library concurrently (see librepcb::library::LibraryUpgrader).
+    bool success = true;
+    int elementCount = 0;
+    int modifiedCount = 0;
+    int ignoredCount = 0;
+    int errorCount = 0;
+    QElapsedTimer timer;
+    timer.start();
+    foreach (const QString& libDir, libDirs) {
+        FilePath libFp(QFileInfo(libDir).absoluteFilePath());
+        print(QString(tr("Open library '%1'...")).arg(prettyPath(libFp, libDir)));
+        library::LibraryUpgrader upgrader(libFp);
+        library::LibraryUpgrader::Result result = upgrader.upgrade(save);
+        foreach (const QString& error, result.errors) {
+            printErr("  " % QString(tr("ERROR: %1")).arg(error));
+            success = false;
+        }
+        print("  " % QString(tr("%1 elements opened, %2 modified, %3 ignored"))
+              .arg(result.elementCount).arg(result.modifiedCount).arg(result.ignoredCount));
+        elementCount += result.elementCount;
+        modifiedCount += result.modifiedCount;
+        ignoredCount += result.ignoredCount;
+        errorCount += result.errors.count();
+    }
+    print(QString(tr("Processed %1 elements in %2 s: %3 modified, %4 ignored, %5 errors."))
+          .arg(elementCount).arg(timer.elapsed() / qreal(1000), 0, 'f', 1)
+          .arg(modifiedCount).arg(ignoredCount).arg(errorCount));
+    return success;
+}
+
+bool CommandLineInterface::importEagleLibraries(const QStringList& inputs,
+    const QString& outputDir, const QString& uuidList,
+    eagleimport::EagleLibraryConverter::ElementTypes types) const noexcept
+{
+    try {
+        // Collect input files
+        QList<FilePath> files;
+        QStringList fileStyles; // for prettyPath()
+        foreach (const QString& input, inputs) {
+            FilePath fp(QFileInfo(input).absoluteFilePath());
+            if (fp.isExistingDir()) {
+                QStringList found;
+                QDirIterator it(fp.toStr(), QStringList{"*.lbr"}, QDir::Files,
+                                QDirIterator::Subdirectories);
+                while (it.hasNext()) {
+                    found.append(it.next());
+                }
+                found.sort();
+                foreach (const QString& filepath, found) {
+                    files.append(FilePath(filepath));
+                    fileStyles.append(input);
+                }
+            } else {
+                files.append(fp);
+                fileStyles.append(input);
+            }
+        }
+
+        // Prepare output directory
+        FilePath outputFp(QFileInfo(outputDir).absoluteFilePath());
+        FileUtils::makePath(outputFp); // can throw
+        FilePath uuidListFp = uuidList.isEmpty()
+            ? outputFp.getPathTo("eagle-import-uuids.sqlite")
+            : FilePath(QFileInfo(uuidList).absoluteFilePath());
+
+        // Convert
+        print(QString(tr("Convert %1 Eagle libraries into '%2'..."))
+              .arg(files.count()).arg(prettyPath(outputFp, outputDir)));
+        QElapsedTimer timer;
+        timer.start();
+        eagleimport::ConverterDb db(uuidListFp);
+        eagleimport::EagleLibraryConverter converter(db, outputFp);
+        QList<eagleimport::EagleLibraryConverter::FileResult> results =
+            converter.convert(files, types);
+
+        // Report results
+        bool success = true;
+        int elementCount = 0;
+        int convertedCount = 0;
+        for (int i = 0; i < results.count(); ++i) {
+            const eagleimport::EagleLibraryConverter::FileResult& result = results.at(i);
+            print(QString(tr("  => '%1': %2 of %3 elements converted"))
+                  .arg(prettyPath(result.inputFile, fileStyles.value(i)))
+                  .arg(result.convertedCount).arg(result.elementCount));
+            foreach (const QString& error, result.errors) {
+                printErr("    " % QString(tr("ERROR: %1")).arg(error));
+                success = false;
+            }
+            elementCount += result.elementCount;
+            convertedCount += result.convertedCount;
+        }
+        db.save(); // can throw
+        print(QString(tr("Converted %1 of %2 elements from %3 libraries in %4 s."))
+              .arg(convertedCount).arg(elementCount).arg(results.count())
+              .arg(timer.elapsed() / qreal(1000), 0, 'f', 1));
+        return success;
+    } catch (const Exception& e) {
+        printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+        return false;
+    }
+}
+
+QFuture<QString> CommandLineInterface::exportImage(const GraphicsSnapshot& snapshot,
+                                                  const FilePath& filepath, qreal dpi,
+                                                  const QColor& background) noexcept
+{
+    return QtConcurrent::run([snapshot, filepath, dpi, background]() -> QString {
+        try {
+            snapshot.saveToFile(filepath, dpi, background); // can throw
+            return QString();
+        } catch (const Exception& e) {
+            return e.getMsg();
+        }
+    });
+}
+
 QString CommandLineInterface::prettyPath(const FilePath& path, const QString& style) noexcept
 {
     return QFileInfo(style).isRelative()
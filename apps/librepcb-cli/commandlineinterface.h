@@ -24,6 +24,8 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtGui>
+#include <librepcb/eagleimport/eaglelibraryconverter.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -32,6 +34,7 @@ namespace librepcb {
 
 class Application;
 class FilePath;
+class GraphicsSnapshot;
 
 namespace cli {
 
@@ -61,9 +64,20 @@ class CommandLineInterface final
         bool openProject(const QString& projectFile,
                          bool runErc,
                          const QStringList& exportSchematicsFiles,
+                         const QStringList& exportSchematicImagesFiles,
+                         const QStringList& exportBoardImagesFiles,
+                         qreal imageDpi,
                          bool exportPcbFabricationData,
                          const QStringList& boards,
                          bool save) const noexcept;
+        bool openLibraries(const QStringList& libDirs, bool save) const noexcept;
+        bool importEagleLibraries(const QStringList& inputs,
+                                  const QString& outputDir,
+                                  const QString& uuidList,
+                                  eagleimport::EagleLibraryConverter::ElementTypes types) const noexcept;
+        static QFuture<QString> exportImage(const GraphicsSnapshot& snapshot,
+                                            const FilePath& filepath, qreal dpi,
+                                            const QColor& background) noexcept;
         static QString prettyPath(const FilePath& path, const QString& style) noexcept;
         static void print(const QString& str, int newlines = 1) noexcept;
         static void printErr(const QString& str, int newlines = 1) noexcept;
@@ -36,6 +36,10 @@ namespace librepcb {
 QString AttributeSubstitutor::substitute(QString str, const AttributeProvider* ap,
                                          FilterFunction filter) noexcept
 {
+    if (!str.contains(QLatin1String("{{"))) {
+        return str; // fast path: there are no variables to substitute
+    }
+
     int startPos = 0;
     int length = 0;
     int outerVariableStart = -1;
@@ -85,7 +89,7 @@ QString AttributeSubstitutor::substitute(QString str, const AttributeProvider* a
 bool AttributeSubstitutor::searchVariablesInText(const QString& text, int startPos, int& pos,
                                                  int& length, QStringList& keys) noexcept
 {
-    QRegularExpression re("\\{\\{(.*?)\\}\\}");
+    static const QRegularExpression re("\\{\\{(.*?)\\}\\}"); // compile only once
     QRegularExpressionMatch match = re.match(text, startPos);
     if (match.hasMatch() && match.capturedLength() > 0) {
         pos = match.capturedStart();
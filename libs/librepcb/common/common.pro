@@ -59,12 +59,14 @@ SOURCES += \
     exceptions.cpp \
     fileio/directorylock.cpp \
     fileio/filepath.cpp \
+    fileio/filewritebatch.cpp \
     fileio/fileutils.cpp \
     fileio/sexpression.cpp \
     fileio/smartfile.cpp \
     fileio/smartsexprfile.cpp \
     fileio/smarttextfile.cpp \
     fileio/smartversionfile.cpp \
+    font/compiledstrokefont.cpp \
     font/strokefont.cpp \
     font/strokefontpool.cpp \
     geometry/circle.cpp \
@@ -82,7 +84,10 @@ SOURCES += \
     graphics/circlegraphicsitem.cpp \
     graphics/defaultgraphicslayerprovider.cpp \
     graphics/graphicslayer.cpp \
+    graphics/graphicslayerid.cpp \
     graphics/graphicsscene.cpp \
+    graphics/graphicssnapshot.cpp \
+    graphics/graphicstilecache.cpp \
     graphics/graphicsview.cpp \
     graphics/holegraphicsitem.cpp \
     graphics/linegraphicsitem.cpp \
@@ -164,6 +169,7 @@ HEADERS += \
     fileio/cmd/cmdlistelementsswap.h \
     fileio/directorylock.h \
     fileio/filepath.h \
+    fileio/filewritebatch.h \
     fileio/fileutils.h \
     fileio/serializablekeyvaluemap.h \
     fileio/serializableobject.h \
@@ -173,6 +179,7 @@ HEADERS += \
     fileio/smartsexprfile.h \
     fileio/smarttextfile.h \
     fileio/smartversionfile.h \
+    font/compiledstrokefont.h \
     font/strokefont.h \
     font/strokefontpool.h \
     geometry/circle.h \
@@ -190,8 +197,11 @@ HEADERS += \
     graphics/circlegraphicsitem.h \
     graphics/defaultgraphicslayerprovider.h \
     graphics/graphicslayer.h \
+    graphics/graphicslayerid.h \
     graphics/graphicslayername.h \
     graphics/graphicsscene.h \
+    graphics/graphicssnapshot.h \
+    graphics/graphicstilecache.h \
     graphics/graphicsview.h \
     graphics/holegraphicsitem.h \
     graphics/if_graphicsvieweventhandler.h \
@@ -227,6 +237,7 @@ HEADERS += \
     utils/clipperhelpers.h \
     utils/exclusiveactiongroup.h \
     utils/graphicslayerstackappearancesettings.h \
+    utils/spatialgridindex.h \
     utils/toolbarproxy.h \
     utils/undostackactiongroup.h \
     uuid.h \
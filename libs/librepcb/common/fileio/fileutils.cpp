@@ -70,6 +70,23 @@ void FileUtils::writeFile(const FilePath& filepath, const QByteArray& content)
     }
 }
 
+bool FileUtils::writeFileIfModified(const FilePath& filepath, const QByteArray& content)
+{
+    // compare the size first to avoid reading files which were modified anyway
+    QFileInfo info(filepath.toStr());
+    if (info.isFile() && (info.size() == content.size())) {
+        try {
+            if (readFile(filepath) == content) { // can throw
+                return false;
+            }
+        } catch (const Exception&) {
+            // if the file can't be read, just try to overwrite it
+        }
+    }
+    writeFile(filepath, content); // can throw
+    return true;
+}
+
 void FileUtils::copyFile(const FilePath& source, const FilePath& dest)
 {
     if (!source.isExistingFile()) {
@@ -79,6 +79,21 @@ class FileUtils final
          */
         static void writeFile(const FilePath& filepath, const QByteArray& content);
 
+        /**
+         * @brief Write the content of a QByteArray into a file, if it is different
+         *
+         * Same as #writeFile(), but if the file already exists with exactly the same
+         * content, it is not touched at all (so its modification time stays the same).
+         *
+         * @param filepath      The file to (over)write
+         * @param content       The content to write
+         *
+         * @return              True if the file was written, false if it was up to date
+         *
+         * @throws Exception    If an error occurs.
+         */
+        static bool writeFileIfModified(const FilePath& filepath, const QByteArray& content);
+
         /**
          * @brief Copy a single file
          *
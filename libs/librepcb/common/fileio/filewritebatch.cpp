@@ -0,0 +1,157 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "filewritebatch.h"
+#include "fileutils.h"
+#include "smartsexprfile.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Static Data
+ ****************************************************************************************/
+
+// the batch which is recorded in the current thread (or nullptr if none)
+static QThreadStorage<FileWriteBatch*> sActiveBatch;
+
+/*****************************************************************************************
+ *  Class FileWriteBatch::Recorder
+ ****************************************************************************************/
+
+FileWriteBatch::Recorder::Recorder(FileWriteBatch& batch) noexcept
+{
+    Q_ASSERT(!sActiveBatch.localData());
+    sActiveBatch.setLocalData(&batch);
+}
+
+FileWriteBatch::Recorder::~Recorder() noexcept
+{
+    // Note: Never leave a pointer in the storage since QThreadStorage would delete it
+    // when the thread exits.
+    sActiveBatch.setLocalData(nullptr);
+}
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+FileWriteBatch::FileWriteBatch() noexcept
+{
+}
+
+FileWriteBatch::FileWriteBatch(const FileWriteBatch& other) noexcept :
+    mOperations(other.mOperations)
+{
+}
+
+FileWriteBatch::~FileWriteBatch() noexcept
+{
+    Q_ASSERT(sActiveBatch.localData() != this);
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void FileWriteBatch::writeFile(const FilePath& filepath, const QByteArray& content) noexcept
+{
+    mOperations.append(Operation{OperationType::WriteContent, filepath, content,
+                                 SExpression()});
+}
+
+void FileWriteBatch::writeFile(const FilePath& filepath, const SExpression& domDocument) noexcept
+{
+    mOperations.append(Operation{OperationType::WriteDom, filepath, QByteArray(),
+                                 domDocument});
+}
+
+void FileWriteBatch::removeFile(const FilePath& filepath) noexcept
+{
+    mOperations.append(Operation{OperationType::Remove, filepath, QByteArray(),
+                                 SExpression()});
+}
+
+bool FileWriteBatch::execute(QStringList& errors, int* writtenFiles) const noexcept
+{
+    bool success = true;
+    foreach (const Operation& op, mOperations) {
+        try {
+            bool written = false;
+            switch (op.type) {
+                case OperationType::WriteContent:
+                    written = FileUtils::writeFileIfModified(op.filepath, op.content); // can throw
+                    break;
+                case OperationType::WriteDom: {
+                    QByteArray content = SmartSExprFile::serialize(op.dom); // can throw
+                    written = FileUtils::writeFileIfModified(op.filepath, content); // can throw
+                    break;
+                }
+                case OperationType::Remove:
+                    if (op.filepath.isExistingFile()) {
+                        FileUtils::removeFile(op.filepath); // can throw
+                        written = true;
+                    }
+                    break;
+                default:
+                    Q_ASSERT(false);
+                    break;
+            }
+            if (written && writtenFiles) {
+                ++(*writtenFiles);
+            }
+        } catch (const Exception& e) {
+            success = false;
+            errors.append(e.getMsg());
+        }
+    }
+    return success;
+}
+
+/*****************************************************************************************
+ *  Operator Overloadings
+ ****************************************************************************************/
+
+FileWriteBatch& FileWriteBatch::operator=(const FileWriteBatch& rhs) noexcept
+{
+    mOperations = rhs.mOperations;
+    return *this;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+FileWriteBatch* FileWriteBatch::getActive() noexcept
+{
+    return sActiveBatch.hasLocalData() ? sActiveBatch.localData() : nullptr;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,144 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_FILEWRITEBATCH_H
+#define LIBREPCB_FILEWRITEBATCH_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "filepath.h"
+#include "sexpression.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class FileWriteBatch
+ ****************************************************************************************/
+
+/**
+ * @brief The FileWriteBatch class records file system operations to execute them later
+ *
+ * While a #Recorder is alive, all #SmartFile objects of the recorder's thread do not
+ * access the file system when saving or removing files. They add the operation to the
+ * batch instead. S-Expressions files are recorded as (implicitly shared) DOM trees, so
+ * recording is cheap. Formatting them and writing the files happens in #execute(), which
+ * may be called in any thread because it only works on the recorded copies.
+ *
+ * This is used to autosave projects without blocking the GUI thread, and to write only
+ * the modified files when upgrading libraries (see librepcb::library::LibraryUpgrader).
+ *
+ * @warning #SmartFile updates its state (e.g. SmartFile#isRestored()) already while
+ *          recording, as if the files were written. This is fine when saving to
+ *          temporary files, where the state does not change. When recording saves to
+ *          the original files, #execute() must be called right afterwards and a
+ *          failure must be handled like a failed save (e.g. by discarding the
+ *          SmartFile objects), since their state no longer matches the file system.
+ */
+class FileWriteBatch final
+{
+        Q_DECLARE_TR_FUNCTIONS(FileWriteBatch)
+
+    public:
+
+        // Types
+
+        /**
+         * @brief Records all file operations of the current thread into a batch
+         *
+         * Recording stops when the recorder is destroyed. Recorders must not be nested.
+         */
+        class Recorder final
+        {
+            public:
+                explicit Recorder(FileWriteBatch& batch) noexcept;
+                Recorder(const Recorder& other) = delete;
+                ~Recorder() noexcept;
+                Recorder& operator=(const Recorder& rhs) = delete;
+        };
+
+        // Constructors / Destructor
+        FileWriteBatch() noexcept;
+        FileWriteBatch(const FileWriteBatch& other) noexcept;
+        ~FileWriteBatch() noexcept;
+
+        // Getters
+        bool isEmpty() const noexcept {return mOperations.isEmpty();}
+        int getCount() const noexcept {return mOperations.count();}
+
+        // General Methods
+        void writeFile(const FilePath& filepath, const QByteArray& content) noexcept;
+        void writeFile(const FilePath& filepath, const SExpression& domDocument) noexcept;
+        void removeFile(const FilePath& filepath) noexcept;
+
+        /**
+         * @brief Execute all recorded operations in the order they were recorded
+         *
+         * If an operation fails, the remaining operations are executed anyway.
+         *
+         * @note This method is reentrant and may be called from any thread.
+         *
+         * @param errors        Error messages of failed operations are appended to this list
+         * @param writtenFiles  If not nullptr, it gets incremented for every file which was
+         *                      actually written or removed (files whose content did not
+         *                      change are not written at all)
+         *
+         * @return True if all operations succeeded, false otherwise
+         */
+        bool execute(QStringList& errors, int* writtenFiles = nullptr) const noexcept;
+
+        // Operator Overloadings
+        FileWriteBatch& operator=(const FileWriteBatch& rhs) noexcept;
+
+        // Static Methods
+
+        /**
+         * @brief Get the batch which is currently recorded in the calling thread
+         *
+         * @return The active batch, or nullptr if no #Recorder exists in this thread
+         */
+        static FileWriteBatch* getActive() noexcept;
+
+
+    private: // Data
+
+        enum class OperationType {WriteContent, WriteDom, Remove};
+
+        struct Operation {
+            OperationType type;
+            FilePath filepath;
+            QByteArray content;
+            SExpression dom;
+        };
+
+        QList<Operation> mOperations;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_FILEWRITEBATCH_H
@@ -257,6 +257,13 @@ SExpression& SExpression::operator=(const SExpression& rhs) noexcept
     return *this;
 }
 
+bool SExpression::operator==(const SExpression& rhs) const noexcept
+{
+    return (mType == rhs.mType)
+        && (mValue == rhs.mValue)
+        && (mChildren == rhs.mChildren); // compares recursively
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -276,6 +283,42 @@ bool SExpression::isValidToken(const QString& token) const noexcept
     return QRegExp("[a-zA-Z0-9\\.:_-]+").exactMatch(token);
 }
 
+int SExpression::skipWhitespaces(const QString& str, int pos) noexcept
+{
+    while ((pos < str.length()) && (str.at(pos).isSpace())) {
+        ++pos;
+    }
+    return pos;
+}
+
+int SExpression::findEndOfNode(const QString& str, int pos, const FilePath& filePath)
+{
+    int depth = 0;
+    bool inString = false;
+    for (; pos < str.length(); ++pos) {
+        QChar c = str.at(pos);
+        if (inString) {
+            if (c == '\\') {
+                ++pos; // skip escaped character
+            } else if (c == '"') {
+                inString = false;
+                if (depth == 0) return pos + 1; // end of string node
+            }
+        } else if (c == '"') {
+            inString = true;
+        } else if (c == '(') {
+            ++depth;
+        } else if (c == ')') {
+            if (depth == 0) return pos; // end of token node (end of parent list)
+            if (--depth == 0) return pos + 1; // end of list node
+        } else if ((depth == 0) && (c.isSpace())) {
+            return pos; // end of token node
+        }
+    }
+    throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                         tr("Unexpected end of file."));
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
@@ -317,6 +360,49 @@ SExpression SExpression::parse(const QString& str, const FilePath& filePath)
     }
 }
 
+SExpression SExpression::parseHeader(const QString& str, const FilePath& filePath,
+                                     const QSet<QString>& nodeNames)
+{
+    // read the name of the root list
+    int pos = skipWhitespaces(str, 0);
+    if ((pos >= str.length()) || (str.at(pos) != '(')) {
+        throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                             tr("File does not have exactly one root node."));
+    }
+    int nameStart = ++pos;
+    while ((pos < str.length()) && (!str.at(pos).isSpace()) && (str.at(pos) != '(')
+           && (str.at(pos) != ')')) {
+        ++pos;
+    }
+    SExpression root(Type::List, str.mid(nameStart, pos - nameStart));
+    root.mFilePath = filePath;
+
+    // parse the leading children one by one, each of them is a complete S-Expression
+    while (true) {
+        pos = skipWhitespaces(str, pos);
+        if (pos >= str.length()) {
+            throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                                 tr("Unexpected end of file."));
+        } else if (str.at(pos) == ')') {
+            break; // end of root node
+        }
+        if (str.at(pos) == '(') {
+            int nameEnd = pos + 1;
+            while ((nameEnd < str.length()) && (!str.at(nameEnd).isSpace())
+                   && (str.at(nameEnd) != '(') && (str.at(nameEnd) != ')')) {
+                ++nameEnd;
+            }
+            if (!nodeNames.contains(str.mid(pos + 1, nameEnd - pos - 1))) {
+                break; // end of header reached, ignore the rest
+            }
+        }
+        int end = findEndOfNode(str, pos, filePath); // can throw
+        root.mChildren.append(parse(str.mid(pos, end - pos), filePath)); // can throw
+        pos = end;
+    }
+    return root;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -137,6 +137,12 @@ class SExpression final
         // Operator Overloadings
         SExpression& operator=(const SExpression& rhs) noexcept;
 
+        /**
+         * @brief Compare the content of two DOM trees (the file path is ignored)
+         */
+        bool operator==(const SExpression& rhs) const noexcept;
+        bool operator!=(const SExpression& rhs) const noexcept {return !(*this == rhs);}
+
         // Static Methods
         static SExpression createList(const QString& name);
         static SExpression createToken(const QString& token);
@@ -144,6 +150,23 @@ class SExpression final
         static SExpression createLineBreak();
         static SExpression parse(const QString& str, const FilePath& filePath);
 
+        /**
+         * @brief Parse only the leading nodes of the root list
+         *
+         * The children of the root node are parsed in order until the first list is
+         * found whose name is not contained in `nodeNames`. The rest of the input is
+         * not parsed at all, so this is much faster than #parse() when only some
+         * "header" nodes at the beginning of a large file are needed.
+         *
+         * @param str           The S-Expression string
+         * @param filePath      The file path (only used for error messages)
+         * @param nodeNames     Names of the root's child lists to parse
+         *
+         * @return The root node, containing only the parsed children
+         */
+        static SExpression parseHeader(const QString& str, const FilePath& filePath,
+                                       const QSet<QString>& nodeNames);
+
 
     private: // Methods
         SExpression(Type type, const QString& value);
@@ -152,6 +175,8 @@ class SExpression final
         QString escapeString(const QString& string) const noexcept;
         bool isValidListName(const QString& name) const noexcept;
         bool isValidToken(const QString& token) const noexcept;
+        static int skipWhitespaces(const QString& str, int pos) noexcept;
+        static int findEndOfNode(const QString& str, int pos, const FilePath& filePath);
 
 
     private: // Data
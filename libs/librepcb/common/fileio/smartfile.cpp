@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "smartfile.h"
 #include "fileutils.h"
+#include "filewritebatch.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -89,7 +90,9 @@ void SmartFile::removeFile(bool original)
     }
 
     FilePath filepath(original ? mFilePath : mTmpFilePath);
-    if (filepath.isExistingFile()) {
+    if (FileWriteBatch* batch = FileWriteBatch::getActive()) {
+        batch->removeFile(filepath);
+    } else if (filepath.isExistingFile()) {
         FileUtils::removeFile(filepath);
     }
 }
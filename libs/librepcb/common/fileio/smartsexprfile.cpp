@@ -24,6 +24,7 @@
 #include "smartsexprfile.h"
 #include "fileutils.h"
 #include "sexpression.h"
+#include "filewritebatch.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -55,11 +56,11 @@ SExpression SmartSExprFile::parseFileAndBuildDomTree() const
 void SmartSExprFile::save(const SExpression& domDocument, bool toOriginal)
 {
     FilePath filepath = prepareSaveAndReturnFilePath(toOriginal); // can throw
-    QString content = domDocument.toString(0); // can throw
-    if (!content.endsWith('\n')) {
-        content.append('\n');
+    if (FileWriteBatch* batch = FileWriteBatch::getActive()) {
+        batch->writeFile(filepath, domDocument); // will be serialized later
+    } else {
+        FileUtils::writeFileIfModified(filepath, serialize(domDocument)); // can throw
     }
-    FileUtils::writeFile(filepath, content.toUtf8()); // can throw
     updateMembersAfterSaving(toOriginal);
 }
 
@@ -67,6 +68,15 @@ void SmartSExprFile::save(const SExpression& domDocument, bool toOriginal)
  *  Static Methods
  ****************************************************************************************/
 
+QByteArray SmartSExprFile::serialize(const SExpression& domDocument)
+{
+    QString content = domDocument.toString(0); // can throw
+    if (!content.endsWith('\n')) {
+        content.append('\n');
+    }
+    return content.toUtf8();
+}
+
 SmartSExprFile* SmartSExprFile::create(const FilePath &filepath)
 {
     return new SmartSExprFile(filepath, false, false, true);
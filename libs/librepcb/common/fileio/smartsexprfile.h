@@ -44,6 +44,7 @@ class SExpression;
  *
  * With #parseFileAndBuildDomTree() the file can be parsed and a DOM tree is created.
  * With #save() the DOM tree can be saved back to the S-Expressions file.
+ * While a FileWriteBatch::Recorder is active, #save() only records the DOM tree.
  *
  * @note See class #SmartFile for more information.
  *
@@ -95,6 +96,8 @@ class SmartSExprFile final : public SmartFile
         /**
          * @brief Write the S-Expressions DOM tree to the file system
          *
+         * If the file already exists with the same content, it is not written again.
+         *
          * @param domDocument   The DOM document to save
          * @param toOriginal    Specifies whether the original or the backup file should
          *                      be overwritten/created.
@@ -110,6 +113,17 @@ class SmartSExprFile final : public SmartFile
 
         // Static Methods
 
+        /**
+         * @brief Format a DOM tree to the content of an S-Expressions file
+         *
+         * @param domDocument   The DOM document to serialize
+         *
+         * @return The file content (UTF-8 encoded)
+         *
+         * @throw Exception If an error occurs
+         */
+        static QByteArray serialize(const SExpression& domDocument);
+
         /**
          * @brief Create a new S-Expressions file
          *
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "smarttextfile.h"
 #include "fileutils.h"
+#include "filewritebatch.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -55,7 +56,11 @@ SmartTextFile::~SmartTextFile() noexcept
 void SmartTextFile::save(bool toOriginal)
 {
     const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal);
-    FileUtils::writeFile(filepath, mContent);
+    if (FileWriteBatch* batch = FileWriteBatch::getActive()) {
+        batch->writeFile(filepath, mContent);
+    } else {
+        FileUtils::writeFileIfModified(filepath, mContent);
+    }
     updateMembersAfterSaving(toOriginal);
 }
 
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "smartversionfile.h"
 #include "fileutils.h"
+#include "filewritebatch.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -55,7 +56,12 @@ SmartVersionFile::~SmartVersionFile() noexcept
 void SmartVersionFile::save(bool toOriginal)
 {
     const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal);
-    FileUtils::writeFile(filepath, QString("%1\n").arg(mVersion.toStr()).toUtf8());
+    QByteArray content = QString("%1\n").arg(mVersion.toStr()).toUtf8();
+    if (FileWriteBatch* batch = FileWriteBatch::getActive()) {
+        batch->writeFile(filepath, content);
+    } else {
+        FileUtils::writeFileIfModified(filepath, content);
+    }
     updateMembersAfterSaving(toOriginal);
 }
 
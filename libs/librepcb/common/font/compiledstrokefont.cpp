@@ -0,0 +1,284 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <cstring>
+#include "compiledstrokefont.h"
+#include "../fileio/filepath.h"
+#include "../fileio/fileutils.h"
+#include <fontobene/font.h>
+#include <fontobene/glyphlistaccessor.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+namespace fb = fontobene;
+
+static const char sMagic[8] = {'L', 'P', 'S', 'F', 'O', 'N', 'T', '\0'};
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+CompiledStrokeFont::CompiledStrokeFont() noexcept :
+    mData(), mGlyphCount(0), mLetterSpacing(0), mLineSpacing(0)
+{
+}
+
+CompiledStrokeFont::CompiledStrokeFont(const QByteArray& data) :
+    mData(data), mGlyphCount(0), mLetterSpacing(0), mLineSpacing(0)
+{
+    int pos = sizeof(sMagic);
+    quint32 version = 0;
+    quint32 count = 0;
+    if ((!mData.startsWith(QByteArray(sMagic, sizeof(sMagic))))
+        || (!readUInt32(pos, version)) || (version != sVersion)
+        || (!readUInt32(pos, count)) || (count > 0x10000)
+        || (!readDouble(pos, mLetterSpacing)) || (!readDouble(pos, mLineSpacing))
+        || (mData.size() < sHeaderSize + int(count) * sIndexEntrySize))
+    {
+        throw RuntimeError(__FILE__, __LINE__, tr("Invalid or unsupported compiled stroke font."));
+    }
+    mGlyphCount = count;
+}
+
+CompiledStrokeFont::~CompiledStrokeFont() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+bool CompiledStrokeFont::getGlyph(uint codepoint, QVector<Polyline>& polylines,
+                                  qreal& spacing) const noexcept
+{
+    polylines.clear();
+    spacing = 0;
+    int pos = findGlyphOffset(codepoint);
+    if (pos < 0) {
+        pos = findGlyphOffset(0xFFFD); // U+FFFD REPLACEMENT CHARACTER
+    }
+    quint32 polylineCount = 0;
+    if ((pos < 0) || (!readDouble(pos, spacing)) || (!readUInt32(pos, polylineCount))) {
+        return false;
+    }
+    for (quint32 i = 0; i < polylineCount; ++i) {
+        quint32 vertexCount = 0;
+        if (!readUInt32(pos, vertexCount)) {
+            return false;
+        }
+        Polyline polyline;
+        for (quint32 k = 0; k < vertexCount; ++k) {
+            Vertex v;
+            if ((!readDouble(pos, v.x)) || (!readDouble(pos, v.y)) || (!readDouble(pos, v.angle))) {
+                return false;
+            }
+            polyline.append(v);
+        }
+        polylines.append(polyline);
+    }
+    return true;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+CompiledStrokeFont CompiledStrokeFont::load(const FilePath& fontFile, const FilePath& cacheDir)
+{
+    QByteArray content = FileUtils::readFile(fontFile); // can throw
+    FilePath cacheFile;
+    if (cacheDir.isValid()) {
+        QString checksum = QCryptographicHash::hash(content, QCryptographicHash::Sha1).toHex();
+        cacheFile = cacheDir.getPathTo(checksum + ".lpfont");
+    }
+
+    if (cacheFile.isExistingFile()) {
+        try {
+            return CompiledStrokeFont(FileUtils::readFile(cacheFile)); // can throw
+        } catch (const Exception& e) {
+            qWarning() << "Ignoring invalid stroke font cache" << cacheFile.toNative()
+                       << ":" << e.getMsg();
+        }
+    }
+
+    CompiledStrokeFont font = compile(fontFile); // can throw
+    if (cacheFile.isValid()) {
+        try {
+            FileUtils::writeFile(cacheFile, font.getData()); // can throw
+        } catch (const Exception& e) {
+            qWarning() << "Failed to write stroke font cache" << cacheFile.toNative()
+                       << ":" << e.getMsg();
+        }
+    }
+    return font;
+}
+
+CompiledStrokeFont CompiledStrokeFont::compile(const FilePath& fontFile)
+{
+    try {
+        fb::Font font(fontFile.toStr()); // can throw
+
+        // Note: No replacement glyph is set here since missing glyphs shall not be
+        // contained in the compiled font. The replacement is done in getGlyph() instead.
+        const QList<QPair<uint, uint>> replacements = {
+            {0x00B5, 0x03BC}, // MICRO SIGN <-> GREEK SMALL LETTER MU
+            {0x2126, 0x03A9}, // OHM SIGN <-> GREEK CAPITAL LETTER OMEGA
+        };
+        fb::GlyphListCache cache(font.glyphs);
+        for (const auto& r : replacements) {
+            cache.addReplacements({r.first, r.second});
+        }
+        fb::GlyphListAccessor accessor(cache);
+
+        // Only the glyphs defined by the font (or reachable by a replacement) can exist,
+        // so there is no need to probe every codepoint. StrokeFont only works with QChar,
+        // so only the basic multilingual plane is needed. The index must be sorted by
+        // codepoint for the binary search in findGlyphOffset().
+        QSet<uint> codepointSet;
+        for (const fb::Glyph& glyph : font.glyphs) {
+            if (glyph.codepoint <= 0xFFFF) codepointSet.insert(glyph.codepoint);
+        }
+        for (const auto& r : replacements) {
+            codepointSet.insert(r.first);
+            codepointSet.insert(r.second);
+        }
+        QList<uint> codepoints = codepointSet.toList();
+        std::sort(codepoints.begin(), codepoints.end());
+
+        QByteArray index;
+        QByteArray glyphs;
+        QDataStream indexStream(&index, QIODevice::WriteOnly);
+        QDataStream glyphStream(&glyphs, QIODevice::WriteOnly);
+        indexStream.setByteOrder(QDataStream::LittleEndian);
+        glyphStream.setByteOrder(QDataStream::LittleEndian);
+        glyphStream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+        quint32 count = 0;
+        foreach (uint codepoint, codepoints) {
+            qreal spacing = 0;
+            QVector<fb::Polyline> polylines;
+            try {
+                polylines = accessor.getAllPolylinesOfGlyph(codepoint, &spacing); // can throw
+            } catch (const fb::Exception&) {
+                continue; // glyph does not exist
+            }
+            quint32 polylineCount = 0;
+            foreach (const fb::Polyline& p, polylines) {
+                if (!p.isEmpty()) ++polylineCount;
+            }
+            if ((polylineCount == 0) && (spacing == 0)) {
+                continue; // glyph does not exist
+            }
+            indexStream << quint32(codepoint) << quint32(glyphStream.device()->pos()); // relative offset
+            glyphStream << qreal(spacing / 9) << polylineCount;
+            foreach (const fb::Polyline& p, polylines) {
+                if (p.isEmpty()) continue;
+                glyphStream << quint32(p.count());
+                foreach (const fb::Vertex& v, p) {
+                    glyphStream << qreal(v.scaledX(1)) << qreal(v.scaledY(1))
+                                << qreal(v.scaledBulge(180));
+                }
+            }
+            ++count;
+        }
+
+        // make the glyph offsets relative to the file start
+        const quint32 glyphsOffset = sHeaderSize + count * sIndexEntrySize;
+        for (quint32 i = 0; i < count; ++i) {
+            uchar* offset = reinterpret_cast<uchar*>(index.data()) + i * sIndexEntrySize + 4;
+            qToLittleEndian<quint32>(qFromLittleEndian<quint32>(offset) + glyphsOffset, offset);
+        }
+
+        QByteArray data;
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+        stream.writeRawData(sMagic, sizeof(sMagic));
+        stream << sVersion << count << qreal(font.header.letterSpacing / 9)
+               << qreal(font.header.lineSpacing / 9);
+        Q_ASSERT(data.size() == sHeaderSize);
+        data.append(index);
+        data.append(glyphs);
+        return CompiledStrokeFont(data); // can throw
+    } catch (const fb::Exception& e) {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Failed to load stroke font "
+            "\"%1\": %2")).arg(fontFile.toNative(), e.msg()));
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+int CompiledStrokeFont::findGlyphOffset(uint codepoint) const noexcept
+{
+    // binary search in the index, which is sorted by codepoint
+    const uchar* index = reinterpret_cast<const uchar*>(mData.constData()) + sHeaderSize;
+    int first = 0;
+    int last = mGlyphCount - 1;
+    while (first <= last) {
+        int middle = first + (last - first) / 2;
+        const uchar* entry = index + middle * sIndexEntrySize;
+        quint32 value = qFromLittleEndian<quint32>(entry);
+        if (value < codepoint) {
+            first = middle + 1;
+        } else if (value > codepoint) {
+            last = middle - 1;
+        } else {
+            quint32 offset = qFromLittleEndian<quint32>(entry + 4);
+            return (offset < quint32(mData.size())) ? int(offset) : -1;
+        }
+    }
+    return -1;
+}
+
+bool CompiledStrokeFont::readUInt32(int& pos, quint32& value) const noexcept
+{
+    if ((pos < 0) || (pos + 4 > mData.size())) {
+        return false;
+    }
+    value = qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(mData.constData()) + pos);
+    pos += 4;
+    return true;
+}
+
+bool CompiledStrokeFont::readDouble(int& pos, qreal& value) const noexcept
+{
+    if ((pos < 0) || (pos + 8 > mData.size())) {
+        return false;
+    }
+    quint64 bits = qFromLittleEndian<quint64>(reinterpret_cast<const uchar*>(mData.constData()) + pos);
+    double d;
+    std::memcpy(&d, &bits, sizeof(d));
+    value = d;
+    pos += 8;
+    return true;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,156 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_COMPILEDSTROKEFONT_H
+#define LIBREPCB_COMPILEDSTROKEFONT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "../exceptions.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class FilePath;
+
+/*****************************************************************************************
+ *  Class CompiledStrokeFont
+ ****************************************************************************************/
+
+/**
+ * @brief A stroke font with already resolved glyphs in a compact binary format
+ *
+ * Parsing a fontobene font (*.bene) and resolving its glyph references takes quite some
+ * time, so #load() converts the font only once and stores the result in a cache
+ * directory. On subsequent loads the binary file is just read, glyphs are decoded
+ * directly from the binary data when they are requested. Cache files are named by the
+ * checksum of the font file, so modified fonts are converted again automatically.
+ *
+ * The binary format (all values little endian):
+ *   - Header: magic "LPSFONT" + '\\0', version (uint32), glyph count (uint32),
+ *     letter spacing (double), line spacing (double)
+ *   - Index: codepoint (uint32) and data offset from file start (uint32) of every glyph,
+ *     sorted by codepoint
+ *   - Glyph data: spacing (double) and polyline count (uint32), followed by the vertex
+ *     count (uint32) and the vertices (x, y, bulge angle in degrees as doubles) of every
+ *     polyline
+ *
+ * All lengths are normalized to a glyph height of 1.
+ */
+class CompiledStrokeFont final
+{
+        Q_DECLARE_TR_FUNCTIONS(CompiledStrokeFont)
+
+    public:
+
+        // Types
+        struct Vertex {
+            qreal x;
+            qreal y;
+            qreal angle; ///< bulge angle in degrees
+        };
+        typedef QVector<Vertex> Polyline;
+
+        // Constructors / Destructor
+        CompiledStrokeFont() noexcept;
+        CompiledStrokeFont(const CompiledStrokeFont& other) = default;
+        explicit CompiledStrokeFont(const QByteArray& data);
+        ~CompiledStrokeFont() noexcept;
+
+        // Getters
+        qreal getLetterSpacing() const noexcept {return mLetterSpacing;}
+        qreal getLineSpacing() const noexcept {return mLineSpacing;}
+        int getGlyphCount() const noexcept {return mGlyphCount;}
+        const QByteArray& getData() const noexcept {return mData;}
+
+        /**
+         * @brief Decode a glyph from the binary data
+         *
+         * If the font does not contain the requested glyph, the replacement character
+         * (U+FFFD) is returned instead (if available).
+         *
+         * @param codepoint     The unicode codepoint of the glyph
+         * @param polylines     The polylines of the glyph are written into this vector
+         * @param spacing       The spacing of the glyph is written into this variable
+         *
+         * @retval true         If the glyph (or its replacement) was found
+         * @retval false        If neither the glyph nor its replacement was found
+         */
+        bool getGlyph(uint codepoint, QVector<Polyline>& polylines,
+                      qreal& spacing) const noexcept;
+
+        // Operator Overloadings
+        CompiledStrokeFont& operator=(const CompiledStrokeFont& rhs) = default;
+
+        // Static Methods
+
+        /**
+         * @brief Load a fontobene font, using the cached binary file if available
+         *
+         * @param fontFile      The *.bene file to load
+         * @param cacheDir      The directory to read/write the binary file from/to (if
+         *                      invalid, the font is always converted)
+         *
+         * @return The loaded font
+         *
+         * @throws Exception    If the font could not be loaded. Errors while accessing
+         *                      the cache are not considered as fatal.
+         */
+        static CompiledStrokeFont load(const FilePath& fontFile, const FilePath& cacheDir);
+
+        /**
+         * @brief Parse a fontobene font and convert it into the binary format
+         *
+         * @param fontFile      The *.bene file to convert
+         *
+         * @return The converted font
+         *
+         * @throws Exception    If the font could not be parsed.
+         */
+        static CompiledStrokeFont compile(const FilePath& fontFile);
+
+
+    private: // Methods
+        int findGlyphOffset(uint codepoint) const noexcept;
+        bool readUInt32(int& pos, quint32& value) const noexcept;
+        bool readDouble(int& pos, qreal& value) const noexcept;
+
+
+    private: // Data
+        QByteArray mData;
+        int mGlyphCount;
+        qreal mLetterSpacing;
+        qreal mLineSpacing;
+
+        static const quint32 sVersion = 1;
+        static const int sHeaderSize = 32;
+        static const int sIndexEntrySize = 8;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_COMPILEDSTROKEFONT_H
@@ -24,16 +24,12 @@
 #include <QtConcurrent/QtConcurrent>
 #include "strokefont.h"
 #include "../fileio/fileutils.h"
-#include <fontobene/font.h>
-#include <fontobene/glyphlistaccessor.h>
 
 /*****************************************************************************************
  *  Namespace
  ****************************************************************************************/
 namespace librepcb {
 
-namespace fb = fontobene;
-
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -41,10 +37,12 @@ namespace fb = fontobene;
 StrokeFont::StrokeFont(const FilePath& fontFilePath) noexcept :
     QObject(nullptr), mFilePath(fontFilePath)
 {
-    // load the font in another thread because it takes some time to load it
+    // load the font in another thread because it takes some time if it is not cached yet
     qDebug() << "Start loading font" << mFilePath.toNative();
-    mFuture = QtConcurrent::run([fontFilePath](){return fb::Font(fontFilePath.toStr());});
-    connect(&mWatcher, &QFutureWatcher<fb::Font>::finished, this, &StrokeFont::fontLoaded);
+    FilePath cacheDir = getCacheDir();
+    mFuture = QtConcurrent::run([fontFilePath, cacheDir](){
+        return CompiledStrokeFont::load(fontFilePath, cacheDir);});
+    connect(&mWatcher, &QFutureWatcher<CompiledStrokeFont>::finished, this, &StrokeFont::fontLoaded);
     mWatcher.setFuture(mFuture);
 }
 
@@ -58,14 +56,12 @@ StrokeFont::~StrokeFont() noexcept
 
 Ratio StrokeFont::getLetterSpacing() const noexcept
 {
-    accessor(); // block until the font is loaded.
-    return Ratio::fromNormalized(mFont->header.letterSpacing / 9);
+    return Ratio::fromNormalized(font().getLetterSpacing()); // blocks until loaded
 }
 
 Ratio StrokeFont::getLineSpacing() const noexcept
 {
-    accessor(); // block until the font is loaded.
-    return Ratio::fromNormalized(mFont->header.lineSpacing / 9);
+    return Ratio::fromNormalized(font().getLineSpacing()); // blocks until loaded
 }
 
 /*****************************************************************************************
@@ -76,7 +72,7 @@ QVector<Path> StrokeFont::stroke(const QString& text, const PositiveLength& heig
     const Length& letterSpacing, const Length& lineSpacing, const Alignment& align,
     Point& bottomLeft, Point& topRight) const noexcept
 {
-    accessor(); // block until the font is loaded. TODO: abort instead of waiting?
+    font(); // block until the font is loaded. TODO: abort instead of waiting?
     QVector<Path> paths;
     Length totalWidth;
     QVector<QPair<QVector<Path>, Length>> lines = strokeLines(text, height, letterSpacing,
@@ -148,20 +144,17 @@ QVector<Path> StrokeFont::strokeLine(const QString& text, const PositiveLength&
     Length offset = 0;
     width = 0; // same as offset, but without last letter spacing
     for (int i = 0; i < text.length(); ++i) {
-        Length glyphSpacing;
-        QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-        if (!glyphPaths.isEmpty()) {
-            Point bottomLeft, topRight;
-            computeBoundingRect(glyphPaths, bottomLeft, topRight);
-            Length shift = (i == 0) ? -bottomLeft.getX() : 0; // left-align first character
-            foreach (const Path& p, glyphPaths) {
+        Glyph glyph = getGlyph(text.at(i), height);
+        if (!glyph.paths.isEmpty()) {
+            Length shift = (i == 0) ? -glyph.bottomLeft.getX() : 0; // left-align first character
+            foreach (const Path& p, glyph.paths) {
                 paths.append(p.translated(Point(offset + shift, Length(0))));
             }
-            width = offset + topRight.getX() + shift; // do *not* count glyph spacing as width!
-            offset = width + glyphSpacing + letterSpacing;
-        } else if (glyphSpacing != 0) {
+            width = offset + glyph.topRight.getX() + shift; // do *not* count glyph spacing as width!
+            offset = width + glyph.spacing + letterSpacing;
+        } else if (glyph.spacing != 0) {
             // it's a whitespace-only glyph -> count additional glyph spacing as width
-            width = offset + glyphSpacing;
+            width = offset + glyph.spacing;
             offset = width + letterSpacing;
         }
     }
@@ -171,80 +164,108 @@ QVector<Path> StrokeFont::strokeLine(const QString& text, const PositiveLength&
 QVector<Path> StrokeFont::strokeGlyph(const QChar& glyph, const PositiveLength& height,
                                       Length& spacing) const noexcept
 {
-    try {
-        qreal glyphSpacing = 0;
-        QVector<fb::Polyline> polylines = accessor().getAllPolylinesOfGlyph(glyph.unicode(),
-                                                                            &glyphSpacing); // can throw
-        spacing = convertLength(height, glyphSpacing);
-        return polylines2paths(polylines, height);
-    } catch (const fb::Exception& e) {
-        qWarning() << "Failed to load stroke font glyph" << glyph;
-        spacing = 0;
-        return QVector<Path>();
-    }
+    Glyph g = getGlyph(glyph, height);
+    spacing = g.spacing;
+    return g.paths;
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+StrokeFont::Glyph StrokeFont::getGlyph(const QChar& glyph,
+                                       const PositiveLength& height) const noexcept
+{
+    QPair<ushort, qint64> key(glyph.unicode(), height->toNm());
+    QMutexLocker locker(&mGlyphCacheMutex);
+    auto it = mGlyphCache.constFind(key);
+    if (it != mGlyphCache.constEnd()) {
+        return *it;
+    }
+    Glyph g = loadGlyph(glyph, height);
+    if (mGlyphCache.count() >= sMaxCachedGlyphs) {
+        mGlyphCache.clear();
+    }
+    mGlyphCache.insert(key, g);
+    return g;
+}
+
+StrokeFont::Glyph StrokeFont::loadGlyph(const QChar& glyph,
+                                        const PositiveLength& height) const noexcept
+{
+    Glyph g;
+    qreal glyphSpacing = 0;
+    QVector<CompiledStrokeFont::Polyline> polylines;
+    if (!font().getGlyph(glyph.unicode(), polylines, glyphSpacing)) {
+        qWarning() << "Failed to load stroke font glyph" << glyph;
+    }
+    g.spacing = convertLength(height, glyphSpacing);
+    g.paths = polylines2paths(polylines, height);
+    if (!g.paths.isEmpty()) {
+        computeBoundingRect(g.paths, g.bottomLeft, g.topRight);
+    }
+    return g;
+}
+
 void StrokeFont::fontLoaded() noexcept
 {
-    accessor(); // trigger the message about loading succeeded or failed
+    font(); // trigger the message about loading succeeded or failed
 }
 
-const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept
+const CompiledStrokeFont& StrokeFont::font() const noexcept
 {
+    QMutexLocker locker(&mFontMutex);
     if (!mFont) {
         try {
-            mFont.reset(new fb::Font(mFuture.result())); // can throw
+            mFont.reset(new CompiledStrokeFont(mFuture.result())); // can throw
             qDebug() << "Successfully loaded font" << mFilePath.toNative()
-                     << "with" << mFont->glyphs.count() << "glyphs";
-        } catch (const fb::Exception& e) {
-            mFont.reset(new fb::Font());
+                     << "with" << mFont->getGlyphCount() << "glyphs";
+        } catch (const Exception& e) {
+            mFont.reset(new CompiledStrokeFont());
             qCritical() << "Failed to load font" << mFilePath.toNative();
-            qCritical() << "Error:" << e.msg();
+            qCritical() << "Error:" << e.getMsg();
         }
-
-        mGlyphListCache.reset(new fb::GlyphListCache(mFont->glyphs));
-        mGlyphListCache->setReplacementGlyph(0xFFFD); // U+FFFD REPLACEMENT CHARACTER
-        mGlyphListCache->addReplacements({0x00B5, 0x03BC}); // MICRO SIGN <-> GREEK SMALL LETTER MU
-        mGlyphListCache->addReplacements({0x2126, 0x03A9}); // OHM SIGN <-> GREEK CAPITAL LETTER OMEGA
-
-        mGlyphListAccessor.reset(new fb::GlyphListAccessor(*mGlyphListCache));
     }
-    return *mGlyphListAccessor;
+    return *mFont;
 }
 
-QVector<Path> StrokeFont::polylines2paths(const QVector<fb::Polyline>& polylines,
+QVector<Path> StrokeFont::polylines2paths(const QVector<CompiledStrokeFont::Polyline>& polylines,
                                           const PositiveLength& height) noexcept
 {
     QVector<Path> paths;
-    foreach (const fb::Polyline& p, polylines) {
+    foreach (const CompiledStrokeFont::Polyline& p, polylines) {
         if (p.isEmpty()) continue;
         paths.append(polyline2path(p, height));
     }
     return paths;
 }
 
-Path StrokeFont::polyline2path(const fb::Polyline& p, const PositiveLength& height) noexcept
+Path StrokeFont::polyline2path(const CompiledStrokeFont::Polyline& p,
+                               const PositiveLength& height) noexcept
 {
     Path path;
-    foreach (const fb::Vertex& v, p) {
+    foreach (const CompiledStrokeFont::Vertex& v, p) {
         path.addVertex(convertVertex(v, height));
     }
     return path;
 }
 
-Vertex StrokeFont::convertVertex(const fb::Vertex& v, const PositiveLength& height) noexcept
+Vertex StrokeFont::convertVertex(const CompiledStrokeFont::Vertex& v,
+                                 const PositiveLength& height) noexcept
 {
-    return Vertex(Point::fromMm(v.scaledX(height->toMm()), v.scaledY(height->toMm())),
-                  Angle::fromDeg(v.scaledBulge(180)));
+    return Vertex(Point::fromMm(v.x * height->toMm(), v.y * height->toMm()),
+                  Angle::fromDeg(v.angle));
 }
 
 Length StrokeFont::convertLength(const PositiveLength& height, qreal length) const noexcept
 {
-    return Length(height->toNm() * length / 9);
+    return Length(height->toNm() * length);
+}
+
+FilePath StrokeFont::getCacheDir() noexcept
+{
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    return dir.isEmpty() ? FilePath() : FilePath(dir).getPathTo("fonts");
 }
 
 void StrokeFont::computeBoundingRect(const QVector<Path>& paths,
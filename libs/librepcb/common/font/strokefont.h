@@ -27,18 +27,11 @@
 #include "../alignment.h"
 #include "../fileio/filepath.h"
 #include "../geometry/path.h"
+#include "compiledstrokefont.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
  ****************************************************************************************/
-namespace fontobene {
-struct Vertex;
-struct Polyline;
-struct Font;
-class GlyphListCache;
-class GlyphListAccessor;
-}
-
 namespace librepcb {
 
 /*****************************************************************************************
@@ -47,6 +40,13 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * The font is loaded with librepcb::CompiledStrokeFont::load(), i.e. the fontobene file
+ * is only parsed if there is no compiled version of it in the cache directory yet.
+ *
+ * Stroked glyphs are cached per glyph and height, so texts consisting of the same few
+ * characters (e.g. reference designators) don't need to be converted from the font
+ * polylines again and again. All methods are thread-safe.
  */
 class StrokeFont final : public QObject
 {
@@ -79,13 +79,29 @@ class StrokeFont final : public QObject
         StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
 
-    private:
+    private: // Types
+
+        /// A stroked glyph of a specific height, as stored in the cache
+        struct Glyph {
+            QVector<Path> paths;
+            Length spacing;
+            Point bottomLeft;   ///< bounding rect of #paths, only valid if not empty
+            Point topRight;     ///< bounding rect of #paths, only valid if not empty
+        };
+
+
+    private: // Methods
+        Glyph getGlyph(const QChar& glyph, const PositiveLength& height) const noexcept;
+        Glyph loadGlyph(const QChar& glyph, const PositiveLength& height) const noexcept;
         void fontLoaded() noexcept;
-        const fontobene::GlyphListAccessor& accessor() const noexcept;
-        static QVector<Path> polylines2paths(const QVector<fontobene::Polyline>& polylines,
+        const CompiledStrokeFont& font() const noexcept;
+        static QVector<Path> polylines2paths(const QVector<CompiledStrokeFont::Polyline>& polylines,
                                              const PositiveLength& height) noexcept;
-        static Path polyline2path(const fontobene::Polyline& p, const PositiveLength& height) noexcept;
-        static Vertex convertVertex(const fontobene::Vertex& v, const PositiveLength& height) noexcept;
+        static Path polyline2path(const CompiledStrokeFont::Polyline& p,
+                                  const PositiveLength& height) noexcept;
+        static Vertex convertVertex(const CompiledStrokeFont::Vertex& v,
+                                    const PositiveLength& height) noexcept;
+        static FilePath getCacheDir() noexcept;
         Length convertLength(const PositiveLength& height, qreal length) const noexcept;
         static void computeBoundingRect(const QVector<Path>& paths,
                                         Point& bottomLeft, Point& topRight) noexcept;
@@ -93,11 +109,17 @@ class StrokeFont final : public QObject
 
     private: // Data
         FilePath mFilePath;
-        QFuture<fontobene::Font> mFuture;
-        QFutureWatcher<fontobene::Font> mWatcher;
-        mutable QScopedPointer<fontobene::Font> mFont;
-        mutable QScopedPointer<fontobene::GlyphListCache> mGlyphListCache;
-        mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+        QFuture<CompiledStrokeFont> mFuture;
+        QFutureWatcher<CompiledStrokeFont> mWatcher;
+        mutable QScopedPointer<CompiledStrokeFont> mFont;
+        mutable QMutex mFontMutex; ///< protects the lazy initialization in #font()
+
+        /// Already stroked glyphs, the key is the unicode value and the height in nm
+        mutable QHash<QPair<ushort, qint64>, Glyph> mGlyphCache;
+        mutable QMutex mGlyphCacheMutex;
+
+        /// The cache is cleared when reaching this size (only happens with many heights)
+        static const int sMaxCachedGlyphs = 10000;
 };
 
 /*****************************************************************************************
@@ -102,6 +102,13 @@ void CmdPolygonEdit::rotate(const Angle& angle, const Point& center, bool immedi
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdPolygonEdit::getEstimatedMemoryUsage() const noexcept
+{
+    return UndoCommand::getEstimatedMemoryUsage()
+        + sizeof(*this) - sizeof(UndoCommand)
+        + (mOldPath.getVertices().capacity() + mNewPath.getVertices().capacity()) * sizeof(Vertex);
+}
+
 bool CmdPolygonEdit::performExecute()
 {
     performRedo(); // can throw
@@ -58,6 +58,11 @@ class CmdPolygonEdit final : public UndoCommand
         void setDeltaToStartPos(const Point& deltaPos, bool immediate) noexcept;
         void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getEstimatedMemoryUsage()
+        qint64 getEstimatedMemoryUsage() const noexcept override;
+
         // Operator Overloadings
         CmdPolygonEdit& operator=(const CmdPolygonEdit& rhs) = delete;
 
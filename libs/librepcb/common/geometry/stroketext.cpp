@@ -313,15 +313,13 @@ void StrokeText::setFont(const StrokeFont* font) noexcept
 
 void StrokeText::updatePaths() noexcept
 {
+    mSubstitutedText = substituteText();
+
     QVector<Path> paths;
     Point center;
     if (mFont) {
-        QString str = mText;
-        if (mAttributeProvider) {
-            str = AttributeSubstitutor::substitute(str, mAttributeProvider);
-        }
         Point bottomLeft, topRight;
-        paths = mFont->stroke(str, mHeight, calcLetterSpacing(), calcLineSpacing(),
+        paths = mFont->stroke(mSubstitutedText, mHeight, calcLetterSpacing(), calcLineSpacing(),
                               mAlign, bottomLeft, topRight);
         center = (bottomLeft + topRight) / 2;
     }
@@ -339,6 +337,14 @@ void StrokeText::updatePaths() noexcept
     }
 }
 
+void StrokeText::updateSubstitutedText() noexcept
+{
+    // stroking is expensive, so skip it if the attributes are not used in the text
+    if (substituteText() != mSubstitutedText) {
+        updatePaths();
+    }
+}
+
 void StrokeText::registerObserver(IF_StrokeTextObserver& object) const noexcept
 {
     mObservers.insert(&object);
@@ -403,6 +409,19 @@ StrokeText& StrokeText::operator=(const StrokeText& rhs) noexcept
     return *this;
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QString StrokeText::substituteText() const noexcept
+{
+    if (mAttributeProvider) {
+        return AttributeSubstitutor::substitute(mText, mAttributeProvider);
+    } else {
+        return mText;
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
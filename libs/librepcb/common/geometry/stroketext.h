@@ -199,6 +199,15 @@ class StrokeText final : public SerializableObject
         void setFont(const StrokeFont* font) noexcept;
         const StrokeFont* getCurrentFont() const noexcept {return mFont;}
         void updatePaths() noexcept;
+
+        /**
+         * @brief Substitute the attributes again and update the paths if needed
+         *
+         * Call this when attributes of the attribute provider have changed. Unlike
+         * #updatePaths(), the text is only stroked again if the substituted text differs
+         * from the currently displayed text.
+         */
+        void updateSubstitutedText() noexcept;
         void registerObserver(IF_StrokeTextObserver& object) const noexcept;
         void unregisterObserver(IF_StrokeTextObserver& object) const noexcept;
 
@@ -211,6 +220,10 @@ class StrokeText final : public SerializableObject
         StrokeText& operator=(const StrokeText& rhs) noexcept;
 
 
+    private: // Methods
+        QString substituteText() const noexcept;
+
+
     private: // Data
         Uuid mUuid;
         GraphicsLayerName mLayerName;
@@ -229,6 +242,7 @@ class StrokeText final : public SerializableObject
         mutable QSet<IF_StrokeTextObserver*> mObservers; ///< A list of all observer objects
         const AttributeProvider* mAttributeProvider; ///< for substituting placeholders in text
         const StrokeFont* mFont; ///< font used for calculating paths
+        QString mSubstitutedText; ///< #mText with substituted attributes, as displayed
         QVector<Path> mPaths; ///< stroke paths without transformations (mirror/rotate/translate)
         QVector<Path> mPathsRotated; ///< same as #mPaths, but rotated by 180°
 };
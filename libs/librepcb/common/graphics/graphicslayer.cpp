@@ -34,14 +34,15 @@ namespace librepcb {
  ****************************************************************************************/
 
 GraphicsLayer::GraphicsLayer(const GraphicsLayer& other) noexcept :
-    QObject(nullptr), mName(other.mName), mNameTr(other.mNameTr), mColor(other.mColor),
+    QObject(nullptr), mName(other.mName), mId(other.mId), mNameTr(other.mNameTr),
+    mColor(other.mColor),
     mColorHighlighted(other.mColorHighlighted), mIsVisible(other.mIsVisible),
     mIsEnabled(other.mIsEnabled)
 {
 }
 
 GraphicsLayer::GraphicsLayer(const QString& name) noexcept :
-    QObject(nullptr), mName(name), mIsEnabled(true)
+    QObject(nullptr), mName(name), mId(name), mIsEnabled(true)
 {
     getDefaultValues(mName, mNameTr, mColor, mColorHighlighted, mIsVisible);
 }
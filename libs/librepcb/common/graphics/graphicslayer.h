@@ -27,6 +27,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "graphicslayername.h"
+#include "graphicslayerid.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -143,6 +144,7 @@ class GraphicsLayer : public QObject
 
         // Getters
         const QString& getName() const noexcept {return mName;}
+        const GraphicsLayerId& getId() const noexcept {return mId;}
         const QString& getNameTr() const noexcept {return mNameTr;}
         const QColor& getColor(bool highlighted = false) const noexcept {
             return highlighted ? mColorHighlighted : mColor;
@@ -150,12 +152,12 @@ class GraphicsLayer : public QObject
         bool getVisible() const noexcept {return mIsVisible;}
         bool isEnabled() const noexcept {return mIsEnabled;}
         bool isVisible() const noexcept {return mIsEnabled && mIsVisible;}
-        bool isTopLayer() const noexcept {return isTopLayer(mName);}
-        bool isBottomLayer() const noexcept {return isBottomLayer(mName);}
-        bool isInnerLayer() const noexcept {return isInnerLayer(mName);}
-        bool isCopperLayer() const noexcept {return isCopperLayer(mName);}
+        bool isTopLayer() const noexcept {return mId.isTopLayer();}
+        bool isBottomLayer() const noexcept {return mId.isBottomLayer();}
+        bool isInnerLayer() const noexcept {return mId.isInnerLayer();}
+        bool isCopperLayer() const noexcept {return mId.isCopperLayer();}
         int getInnerLayerNumber() const noexcept {return getInnerLayerNumber(mName);}
-        QString getMirroredLayerName() const noexcept {return getMirroredLayerName(mName);}
+        QString getMirroredLayerName() const noexcept {return mId.getMirrored().getName();}
         QString getGrabAreaLayerName() const noexcept {return getGrabAreaLayerName(mName);}
 
         // Setters
@@ -193,6 +195,7 @@ class GraphicsLayer : public QObject
 
     protected: // Data
         QString mName;              ///< Unique name which is used for serialization
+        GraphicsLayerId mId;        ///< Interned #mName for fast comparisons
         QString mNameTr;            ///< Layer name (translated into the user's language)
         QColor mColor;              ///< Color of graphics items on that layer
         QColor mColorHighlighted;   ///< Color of hightlighted graphics items on that layer
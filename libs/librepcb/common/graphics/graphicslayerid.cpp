@@ -0,0 +1,132 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "graphicslayerid.h"
+#include "graphicslayer.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Registry
+ ****************************************************************************************/
+
+namespace {
+
+struct Registry {
+    QReadWriteLock lock;
+    QHash<QString, const void*> entries; ///< the values are GraphicsLayerId::Entry*
+};
+
+Registry& registry() noexcept
+{
+    static Registry r;
+    return r;
+}
+
+} // namespace
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+const QString& GraphicsLayerId::getName() const noexcept
+{
+    static const QString empty;
+    return mEntry ? mEntry->name : empty;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+GraphicsLayerId GraphicsLayerId::find(const QString& name) noexcept
+{
+    Registry& r = registry();
+    QReadLocker locker(&r.lock);
+    return GraphicsLayerId(static_cast<const Entry*>(r.entries.value(name, nullptr)));
+}
+
+int GraphicsLayerId::getRegisteredCount() noexcept
+{
+    Registry& r = registry();
+    QReadLocker locker(&r.lock);
+    return r.entries.count();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+const GraphicsLayerId::Entry* GraphicsLayerId::intern(const QString& name) noexcept
+{
+    Registry& r = registry();
+    {
+        QReadLocker locker(&r.lock);
+        const void* entry = r.entries.value(name, nullptr);
+        if (entry) return static_cast<const Entry*>(entry);
+    }
+
+    QWriteLocker locker(&r.lock);
+    const void* existing = r.entries.value(name, nullptr);
+    if (existing) return static_cast<const Entry*>(existing); // registered in the meantime
+
+    // register the name together with its mirrored counterpart
+    Entry* entry = createEntry(name, r.entries.count());
+    r.entries.insert(name, entry);
+    QString mirroredName = GraphicsLayer::getMirroredLayerName(name);
+    if (mirroredName == name) {
+        entry->mirrored = entry;
+    } else {
+        Entry* mirrored = const_cast<Entry*>(static_cast<const Entry*>(
+            r.entries.value(mirroredName, nullptr)));
+        if (!mirrored) {
+            mirrored = createEntry(mirroredName, r.entries.count());
+            r.entries.insert(mirroredName, mirrored);
+        }
+        entry->mirrored = mirrored;
+        mirrored->mirrored = entry;
+    }
+    return entry;
+}
+
+GraphicsLayerId::Entry* GraphicsLayerId::createEntry(const QString& name, int index) noexcept
+{
+    Entry* entry = new Entry();
+    entry->index = index;
+    entry->name = name;
+    entry->mirrored = nullptr;
+    entry->isTop = GraphicsLayer::isTopLayer(name);
+    entry->isBottom = GraphicsLayer::isBottomLayer(name);
+    entry->isInner = GraphicsLayer::isInnerLayer(name);
+    entry->isCopper = GraphicsLayer::isCopperLayer(name);
+    return entry;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
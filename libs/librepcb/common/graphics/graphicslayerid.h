@@ -0,0 +1,193 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GRAPHICSLAYERID_H
+#define LIBREPCB_GRAPHICSLAYERID_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class GraphicsLayerId
+ ****************************************************************************************/
+
+/**
+ * @brief An interned identifier of a librepcb::GraphicsLayer
+ *
+ * Layers are identified by their names (e.g. "top_cu") in files and in the UI, but
+ * comparing and mapping these strings is quite expensive on hot paths like rendering
+ * or exporting boards. A GraphicsLayerId is created once from a layer name and then
+ * allows constant-time comparison, mirroring and (with librepcb::GraphicsLayerIdSet)
+ * set membership tests.
+ *
+ * Every distinct layer name is registered only once per process, all IDs of the same
+ * name refer to the same registry entry. The integer values (see #toInt()) are small
+ * and dense, but depend on the order of registration, so they must never be
+ * serialized. Use the layer name for that.
+ *
+ * This class is thread-safe.
+ */
+class GraphicsLayerId final
+{
+    public:
+
+        // Constructors / Destructor
+        GraphicsLayerId() noexcept : mEntry(nullptr) {}
+        GraphicsLayerId(const GraphicsLayerId& other) noexcept : mEntry(other.mEntry) {}
+        explicit GraphicsLayerId(const QString& name) noexcept : mEntry(intern(name)) {}
+        ~GraphicsLayerId() noexcept {}
+
+        // Getters
+        bool isValid() const noexcept {return mEntry != nullptr;}
+        int toInt() const noexcept {return mEntry ? mEntry->index : -1;}
+        const QString& getName() const noexcept;
+        GraphicsLayerId getMirrored() const noexcept {
+            return GraphicsLayerId(mEntry ? mEntry->mirrored : nullptr);
+        }
+        bool isTopLayer() const noexcept {return mEntry && mEntry->isTop;}
+        bool isBottomLayer() const noexcept {return mEntry && mEntry->isBottom;}
+        bool isInnerLayer() const noexcept {return mEntry && mEntry->isInner;}
+        bool isCopperLayer() const noexcept {return mEntry && mEntry->isCopper;}
+
+        // Operator Overloadings
+        GraphicsLayerId& operator=(const GraphicsLayerId& rhs) noexcept {
+            mEntry = rhs.mEntry;
+            return *this;
+        }
+        bool operator==(const GraphicsLayerId& rhs) const noexcept {return mEntry == rhs.mEntry;}
+        bool operator!=(const GraphicsLayerId& rhs) const noexcept {return mEntry != rhs.mEntry;}
+        bool operator<(const GraphicsLayerId& rhs) const noexcept {return toInt() < rhs.toInt();}
+
+        // Static Methods
+
+        /**
+         * @brief Get the ID of an already registered layer name
+         *
+         * In contrast to the constructor, this does not register unknown names.
+         *
+         * @param name  The layer name
+         *
+         * @return The ID of the layer, or an invalid ID if the name is not registered
+         */
+        static GraphicsLayerId find(const QString& name) noexcept;
+
+        /**
+         * @brief Get the number of registered layer names
+         *
+         * @return An upper bound of the integer values of all existing IDs
+         */
+        static int getRegisteredCount() noexcept;
+
+
+    private: // Types
+
+        struct Entry {
+            int index;
+            QString name;
+            const Entry* mirrored;
+            bool isTop;
+            bool isBottom;
+            bool isInner;
+            bool isCopper;
+        };
+
+
+    private: // Methods
+        explicit GraphicsLayerId(const Entry* entry) noexcept : mEntry(entry) {}
+        static const Entry* intern(const QString& name) noexcept;
+        static Entry* createEntry(const QString& name, int index) noexcept;
+
+
+    private: // Data
+        const Entry* mEntry; ///< points to the registry entry, which is never deleted
+};
+
+inline uint qHash(const GraphicsLayerId& key, uint seed = 0) noexcept {
+    return ::qHash(key.toInt(), seed);
+}
+
+inline QDebug operator<<(QDebug stream, const GraphicsLayerId& obj) {
+    stream << QString("GraphicsLayerId('%1')").arg(obj.getName());
+    return stream;
+}
+
+/*****************************************************************************************
+ *  Class GraphicsLayerIdSet
+ ****************************************************************************************/
+
+/**
+ * @brief A set of librepcb::GraphicsLayerId, implemented as a bitset
+ */
+class GraphicsLayerIdSet final
+{
+    public:
+
+        // Constructors / Destructor
+        GraphicsLayerIdSet() noexcept : mBits() {}
+        GraphicsLayerIdSet(const GraphicsLayerIdSet& other) noexcept : mBits(other.mBits) {}
+        GraphicsLayerIdSet(std::initializer_list<GraphicsLayerId> ids) noexcept : mBits() {
+            for (const GraphicsLayerId& id : ids) insert(id);
+        }
+        ~GraphicsLayerIdSet() noexcept {}
+
+        // Getters
+        bool isEmpty() const noexcept {return mBits.count(true) == 0;}
+        bool contains(const GraphicsLayerId& id) const noexcept {
+            int i = id.toInt();
+            return (i >= 0) && (i < mBits.size()) && mBits.testBit(i);
+        }
+
+        // General Methods
+        void insert(const GraphicsLayerId& id) noexcept {
+            int i = id.toInt();
+            if (i < 0) return;
+            if (i >= mBits.size()) mBits.resize(i + 1);
+            mBits.setBit(i);
+        }
+        void remove(const GraphicsLayerId& id) noexcept {
+            int i = id.toInt();
+            if ((i >= 0) && (i < mBits.size())) mBits.clearBit(i);
+        }
+        void clear() noexcept {mBits.clear();}
+
+        // Operator Overloadings
+        GraphicsLayerIdSet& operator=(const GraphicsLayerIdSet& rhs) noexcept {
+            mBits = rhs.mBits;
+            return *this;
+        }
+
+
+    private: // Data
+        QBitArray mBits; ///< indexed by librepcb::GraphicsLayerId::toInt()
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_GRAPHICSLAYERID_H
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "graphicsscene.h"
+#include "graphicstilecache.h"
 #include "../units/point.h"
 
 /*****************************************************************************************
@@ -46,6 +47,7 @@ GraphicsScene::GraphicsScene() noexcept :
     mSelectionRectItem->setPen(QPen(QColor(120, 170, 255, 255), 0));
     mSelectionRectItem->setBrush(selectBrush);
     mSelectionRectItem->setZValue(1000);
+    GraphicsTileCache::setCacheable(*mSelectionRectItem, false);
     QGraphicsScene::addItem(mSelectionRectItem);
 }
 
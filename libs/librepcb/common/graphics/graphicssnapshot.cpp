@@ -0,0 +1,403 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include "graphicssnapshot.h"
+#include "../exceptions.h"
+#include "../fileio/filepath.h"
+#include "../fileio/fileutils.h"
+#include "../units/length.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+// maximum width and height of rendered images in pixels
+static const int sMaxImageSize = 16384;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+GraphicsSnapshot::GraphicsSnapshot() noexcept
+{
+}
+
+GraphicsSnapshot::GraphicsSnapshot(const GraphicsSnapshot& other) noexcept :
+    mPrimitives(other.mPrimitives), mBoundingRect(other.mBoundingRect)
+{
+}
+
+GraphicsSnapshot::~GraphicsSnapshot() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Recording Methods
+ ****************************************************************************************/
+
+void GraphicsSnapshot::drawPath(const QPainterPath& path, const QPen& pen,
+                                const QBrush& brush, const QTransform& transform) noexcept
+{
+    if (path.isEmpty()) return;
+    if ((pen.style() == Qt::NoPen) && (brush.style() == Qt::NoBrush)) return;
+
+    Primitive p;
+    p.type = Primitive::Type::Path;
+    p.transform = transform;
+    p.pen = pen;
+    p.brush = brush;
+    p.path = path;
+    p.textFlags = 0;
+    const qreal margin = (pen.style() != Qt::NoPen) ? (pen.widthF() / 2) : 0;
+    addPrimitive(p, path.boundingRect().adjusted(-margin, -margin, margin, margin));
+}
+
+void GraphicsSnapshot::drawLine(const QLineF& line, const QPen& pen,
+                                const QTransform& transform) noexcept
+{
+    QPainterPath path;
+    path.moveTo(line.p1());
+    path.lineTo(line.p2());
+    drawPath(path, pen, Qt::NoBrush, transform);
+}
+
+void GraphicsSnapshot::drawEllipse(const QPointF& center, qreal rx, qreal ry,
+                                   const QPen& pen, const QBrush& brush,
+                                   const QTransform& transform) noexcept
+{
+    QPainterPath path;
+    path.addEllipse(center, rx, ry);
+    drawPath(path, pen, brush, transform);
+}
+
+void GraphicsSnapshot::drawText(const QRectF& rect, int flags, const QString& text,
+                                const QFont& font, const QColor& color,
+                                const QTransform& transform) noexcept
+{
+    if (text.isEmpty()) return;
+
+    Primitive p;
+    p.type = Primitive::Type::Text;
+    p.transform = transform;
+    p.pen = QPen(color, 0);
+    p.textRect = rect;
+    p.textFlags = flags;
+    p.text = text;
+    p.font = font;
+    addPrimitive(p, QFontMetricsF(font).boundingRect(rect, flags, text));
+}
+
+/*****************************************************************************************
+ *  Rendering Methods
+ ****************************************************************************************/
+
+void GraphicsSnapshot::paint(QPainter& painter) const noexcept
+{
+    foreach (const Primitive& p, mPrimitives) {
+        painter.save();
+        painter.setTransform(p.transform, true);
+        painter.setPen(p.pen);
+        switch (p.type) {
+            case Primitive::Type::Path: {
+                painter.setBrush(p.brush);
+                painter.drawPath(p.path);
+                break;
+            }
+            case Primitive::Type::Text: {
+                painter.setFont(p.font);
+                painter.drawText(p.textRect, p.textFlags, p.text);
+                break;
+            }
+            default: {
+                Q_ASSERT(false);
+                break;
+            }
+        }
+        painter.restore();
+    }
+}
+
+QImage GraphicsSnapshot::toImage(qreal dpi, const QColor& background) const noexcept
+{
+    const QRectF rect = getImageRect();
+    const qreal scale = dpi / Length::fromInch(1).toPx();
+    const QSize size = QSizeF(rect.size() * scale).toSize().expandedTo(QSize(1, 1));
+    if ((size.width() > sMaxImageSize) || (size.height() > sMaxImageSize)) {
+        return QImage();
+    }
+
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    if (image.isNull()) return image; // out of memory
+    const qreal dotsPerMeter = dpi / 0.0254;
+    image.setDotsPerMeterX(qRound(dotsPerMeter));
+    image.setDotsPerMeterY(qRound(dotsPerMeter));
+    image.fill(background);
+
+    QPainter painter(&image);
+    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing);
+    painter.scale(scale, scale);
+    painter.translate(-rect.topLeft());
+    paint(painter);
+    return image;
+}
+
+QByteArray GraphicsSnapshot::toSvg(const QColor& background) const noexcept
+{
+    const QRectF rect = getImageRect();
+    const qreal mmPerPx = Length::fromPx(1).toMm();
+
+    QByteArray content;
+    QXmlStreamWriter xml(&content);
+    xml.setAutoFormatting(true);
+    xml.writeStartDocument();
+    xml.writeStartElement("svg");
+    xml.writeDefaultNamespace("http://www.w3.org/2000/svg");
+    xml.writeAttribute("version", "1.1");
+    xml.writeAttribute("width", toSvgNumber(rect.width() * mmPerPx) % "mm");
+    xml.writeAttribute("height", toSvgNumber(rect.height() * mmPerPx) % "mm");
+    xml.writeAttribute("viewBox", QString("%1 %2 %3 %4")
+                       .arg(toSvgNumber(rect.x()), toSvgNumber(rect.y()),
+                            toSvgNumber(rect.width()), toSvgNumber(rect.height())));
+
+    if (background.alpha() > 0) {
+        xml.writeEmptyElement("rect");
+        xml.writeAttribute("x", toSvgNumber(rect.x()));
+        xml.writeAttribute("y", toSvgNumber(rect.y()));
+        xml.writeAttribute("width", toSvgNumber(rect.width()));
+        xml.writeAttribute("height", toSvgNumber(rect.height()));
+        xml.writeAttribute("fill", toSvgColor(background));
+        if (background.alpha() < 255) {
+            xml.writeAttribute("fill-opacity", toSvgNumber(background.alphaF()));
+        }
+    }
+
+    foreach (const Primitive& p, mPrimitives) {
+        switch (p.type) {
+            case Primitive::Type::Path: {
+                xml.writeEmptyElement("path");
+                if (!p.transform.isIdentity()) {
+                    xml.writeAttribute("transform", toSvgTransform(p.transform));
+                }
+                xml.writeAttribute("d", toSvgPathData(p.path));
+                if (p.brush.style() != Qt::NoBrush) {
+                    xml.writeAttribute("fill", toSvgColor(p.brush.color()));
+                    if (p.brush.color().alpha() < 255) {
+                        xml.writeAttribute("fill-opacity", toSvgNumber(p.brush.color().alphaF()));
+                    }
+                    xml.writeAttribute("fill-rule", (p.path.fillRule() == Qt::WindingFill)
+                                       ? "nonzero" : "evenodd");
+                } else {
+                    xml.writeAttribute("fill", "none");
+                }
+                if (p.pen.style() != Qt::NoPen) {
+                    xml.writeAttribute("stroke", toSvgColor(p.pen.color()));
+                    if (p.pen.color().alpha() < 255) {
+                        xml.writeAttribute("stroke-opacity", toSvgNumber(p.pen.color().alphaF()));
+                    }
+                    if (p.pen.isCosmetic()) {
+                        xml.writeAttribute("stroke-width", "1");
+                        xml.writeAttribute("vector-effect", "non-scaling-stroke");
+                    } else {
+                        xml.writeAttribute("stroke-width", toSvgNumber(p.pen.widthF()));
+                    }
+                    switch (p.pen.capStyle()) {
+                        case Qt::RoundCap:  xml.writeAttribute("stroke-linecap", "round"); break;
+                        case Qt::SquareCap: xml.writeAttribute("stroke-linecap", "square"); break;
+                        default:            xml.writeAttribute("stroke-linecap", "butt"); break;
+                    }
+                    switch (p.pen.joinStyle()) {
+                        case Qt::RoundJoin: xml.writeAttribute("stroke-linejoin", "round"); break;
+                        case Qt::BevelJoin: xml.writeAttribute("stroke-linejoin", "bevel"); break;
+                        default:            xml.writeAttribute("stroke-linejoin", "miter"); break;
+                    }
+                }
+                break;
+            }
+            case Primitive::Type::Text: {
+                // map the alignment within the text rect to the SVG text anchor
+                qreal x, y;
+                QString anchor, baseline;
+                if (p.textFlags & Qt::AlignHCenter) {
+                    x = p.textRect.center().x();
+                    anchor = "middle";
+                } else if (p.textFlags & Qt::AlignRight) {
+                    x = p.textRect.right();
+                    anchor = "end";
+                } else {
+                    x = p.textRect.left();
+                    anchor = "start";
+                }
+                if (p.textFlags & Qt::AlignVCenter) {
+                    y = p.textRect.center().y();
+                    baseline = "central";
+                } else if (p.textFlags & Qt::AlignBottom) {
+                    y = p.textRect.bottom();
+                    baseline = "text-after-edge";
+                } else {
+                    y = p.textRect.top();
+                    baseline = "text-before-edge";
+                }
+                xml.writeStartElement("text");
+                if (!p.transform.isIdentity()) {
+                    xml.writeAttribute("transform", toSvgTransform(p.transform));
+                }
+                xml.writeAttribute("x", toSvgNumber(x));
+                xml.writeAttribute("y", toSvgNumber(y));
+                xml.writeAttribute("font-family", p.font.family());
+                xml.writeAttribute("font-size", toSvgNumber(QFontInfo(p.font).pixelSize()));
+                xml.writeAttribute("fill", toSvgColor(p.pen.color()));
+                xml.writeAttribute("text-anchor", anchor);
+                xml.writeAttribute("dominant-baseline", baseline);
+                xml.writeAttribute("xml:space", "preserve");
+                xml.writeCharacters(p.text);
+                xml.writeEndElement(); // text
+                break;
+            }
+            default: {
+                Q_ASSERT(false);
+                break;
+            }
+        }
+    }
+
+    xml.writeEndElement(); // svg
+    xml.writeEndDocument();
+    return content;
+}
+
+void GraphicsSnapshot::saveToFile(const FilePath& filepath, qreal dpi,
+                                  const QColor& background) const
+{
+    QByteArray content;
+    const QString suffix = filepath.getSuffix().toLower();
+    if (suffix == "svg") {
+        content = toSvg(background);
+    } else if (getSupportedFileSuffixes().contains(suffix)) {
+        QImage image = toImage(dpi, background);
+        if (image.isNull()) {
+            throw RuntimeError(__FILE__, __LINE__, QString(tr("Could not render the image "
+                "\"%1\" because it is too large. Please choose a lower resolution."))
+                .arg(filepath.toNative()));
+        }
+        QBuffer buffer(&content);
+        buffer.open(QIODevice::WriteOnly);
+        if (!image.save(&buffer, qPrintable(suffix))) {
+            throw RuntimeError(__FILE__, __LINE__, QString(tr(
+                "Could not encode the image \"%1\".")).arg(filepath.toNative()));
+        }
+    } else {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr(
+            "Unsupported file extension: \"%1\"")).arg(suffix));
+    }
+    FileUtils::writeFile(filepath, content); // can throw
+}
+
+/*****************************************************************************************
+ *  Operator Overloadings
+ ****************************************************************************************/
+
+GraphicsSnapshot& GraphicsSnapshot::operator=(const GraphicsSnapshot& rhs) noexcept
+{
+    mPrimitives = rhs.mPrimitives;
+    mBoundingRect = rhs.mBoundingRect;
+    return *this;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QStringList GraphicsSnapshot::getSupportedFileSuffixes() noexcept
+{
+    QStringList suffixes("svg");
+    foreach (const QByteArray& format, QImageWriter::supportedImageFormats()) {
+        QString suffix = QString::fromLatin1(format).toLower();
+        if (!suffixes.contains(suffix)) suffixes.append(suffix);
+    }
+    return suffixes;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void GraphicsSnapshot::addPrimitive(const Primitive& primitive, const QRectF& rect) noexcept
+{
+    mPrimitives.append(primitive);
+    mBoundingRect = mBoundingRect.united(primitive.transform.mapRect(rect));
+}
+
+QRectF GraphicsSnapshot::getImageRect() const noexcept
+{
+    // add a small margin around the content
+    const qreal margin = Length::fromMm(1).toPx();
+    return mBoundingRect.adjusted(-margin, -margin, margin, margin);
+}
+
+QString GraphicsSnapshot::toSvgColor(const QColor& color) noexcept
+{
+    return color.name(QColor::HexRgb);
+}
+
+QString GraphicsSnapshot::toSvgNumber(qreal value) noexcept
+{
+    return QString::number(value, 'g', 10);
+}
+
+QString GraphicsSnapshot::toSvgPathData(const QPainterPath& path) noexcept
+{
+    QStringList data;
+    for (int i = 0; i < path.elementCount(); ++i) {
+        const QPainterPath::Element& e = path.elementAt(i);
+        switch (e.type) {
+            case QPainterPath::MoveToElement:
+                data.append("M" % toSvgNumber(e.x) % " " % toSvgNumber(e.y));
+                break;
+            case QPainterPath::LineToElement:
+                data.append("L" % toSvgNumber(e.x) % " " % toSvgNumber(e.y));
+                break;
+            case QPainterPath::CurveToElement:
+                data.append("C" % toSvgNumber(e.x) % " " % toSvgNumber(e.y));
+                break;
+            case QPainterPath::CurveToDataElement:
+                data.append(toSvgNumber(e.x) % " " % toSvgNumber(e.y));
+                break;
+        }
+    }
+    return data.join(' ');
+}
+
+QString GraphicsSnapshot::toSvgTransform(const QTransform& t) noexcept
+{
+    return QString("matrix(%1 %2 %3 %4 %5 %6)")
+        .arg(toSvgNumber(t.m11()), toSvgNumber(t.m12()), toSvgNumber(t.m21()),
+             toSvgNumber(t.m22()), toSvgNumber(t.dx()), toSvgNumber(t.dy()));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
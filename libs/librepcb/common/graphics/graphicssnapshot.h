@@ -0,0 +1,164 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GRAPHICSSNAPSHOT_H
+#define LIBREPCB_GRAPHICSSNAPSHOT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class FilePath;
+
+/*****************************************************************************************
+ *  Class GraphicsSnapshot
+ ****************************************************************************************/
+
+/**
+ * @brief An immutable list of drawing primitives (e.g. one schematic page or one board
+ *        layer) which can be rendered independently of the items it was created from
+ *
+ * The graphics items of boards and schematics can only be painted in the GUI thread
+ * because they access the data model (and several caches of it) while painting. For
+ * exporting, the primitives are instead recorded into a snapshot in the GUI thread,
+ * which then can be rendered to images, SVG or any QPainter in worker threads. All
+ * const methods are reentrant, so a snapshot can even be rendered by several threads
+ * at the same time.
+ *
+ * All coordinates are scene pixels as used by the graphics items (see
+ * librepcb::Length::toPx()).
+ */
+class GraphicsSnapshot final
+{
+        Q_DECLARE_TR_FUNCTIONS(GraphicsSnapshot)
+
+    public:
+
+        // Constructors / Destructor
+        GraphicsSnapshot() noexcept;
+        GraphicsSnapshot(const GraphicsSnapshot& other) noexcept;
+        ~GraphicsSnapshot() noexcept;
+
+        // Getters
+        bool isEmpty() const noexcept {return mPrimitives.isEmpty();}
+        int getPrimitiveCount() const noexcept {return mPrimitives.count();}
+        const QRectF& getBoundingRect() const noexcept {return mBoundingRect;}
+
+        // Recording Methods
+        void drawPath(const QPainterPath& path, const QPen& pen, const QBrush& brush,
+                      const QTransform& transform = QTransform()) noexcept;
+        void drawLine(const QLineF& line, const QPen& pen,
+                      const QTransform& transform = QTransform()) noexcept;
+        void drawEllipse(const QPointF& center, qreal rx, qreal ry, const QPen& pen,
+                         const QBrush& brush, const QTransform& transform = QTransform()) noexcept;
+        void drawText(const QRectF& rect, int flags, const QString& text, const QFont& font,
+                      const QColor& color, const QTransform& transform = QTransform()) noexcept;
+
+        // Rendering Methods
+
+        /**
+         * @brief Paint all primitives on a QPainter (using its current transformation)
+         *
+         * @param painter   The painter to paint on
+         */
+        void paint(QPainter& painter) const noexcept;
+
+        /**
+         * @brief Render the whole snapshot into an image
+         *
+         * @param dpi           Resolution of the image in dots per inch
+         * @param background    Background color of the image (may be transparent)
+         *
+         * @return The rendered image (a null image if it would be too large)
+         */
+        QImage toImage(qreal dpi, const QColor& background) const noexcept;
+
+        /**
+         * @brief Convert the whole snapshot into a SVG document (in real size)
+         *
+         * @param background    Background color of the document (may be transparent)
+         *
+         * @return The SVG file content
+         */
+        QByteArray toSvg(const QColor& background) const noexcept;
+
+        /**
+         * @brief Write the snapshot into an image or SVG file
+         *
+         * @param filepath      The file to write. The format is determined by its suffix,
+         *                      see #getSupportedFileSuffixes().
+         * @param dpi           Resolution of raster images in dots per inch
+         * @param background    Background color (may be transparent)
+         *
+         * @throws Exception    If the format is not supported or the file could not be
+         *                      written.
+         */
+        void saveToFile(const FilePath& filepath, qreal dpi, const QColor& background) const;
+
+        // Operator Overloadings
+        GraphicsSnapshot& operator=(const GraphicsSnapshot& rhs) noexcept;
+
+        // Static Methods
+        static QStringList getSupportedFileSuffixes() noexcept;
+
+
+    private: // Types
+
+        struct Primitive {
+            enum class Type {Path, Text};
+            Type type;
+            QTransform transform;
+            QPen pen;               ///< for texts, the pen color is the text color
+            QBrush brush;
+            QPainterPath path;      ///< only used for Type::Path
+            QRectF textRect;        ///< only used for Type::Text
+            int textFlags;          ///< only used for Type::Text
+            QString text;           ///< only used for Type::Text
+            QFont font;             ///< only used for Type::Text
+        };
+
+
+    private: // Methods
+        void addPrimitive(const Primitive& primitive, const QRectF& rect) noexcept;
+        QRectF getImageRect() const noexcept;
+        static QString toSvgColor(const QColor& color) noexcept;
+        static QString toSvgNumber(qreal value) noexcept;
+        static QString toSvgPathData(const QPainterPath& path) noexcept;
+        static QString toSvgTransform(const QTransform& transform) noexcept;
+
+
+    private: // Data
+        QVector<Primitive> mPrimitives;
+        QRectF mBoundingRect;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_GRAPHICSSNAPSHOT_H
@@ -0,0 +1,184 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "graphicstilecache.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+// key of QGraphicsItem::data() to mark items which must not be cached
+static const int sNotCacheableDataKey = 0x4C50544C;
+
+// maximum size of all cached tiles in kB
+static const int sMaxCacheSize = 64 * 1024;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+GraphicsTileCache::GraphicsTileCache() noexcept :
+    mTiles(sMaxCacheSize)
+{
+}
+
+GraphicsTileCache::~GraphicsTileCache() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void GraphicsTileCache::paint(QPainter& painter, const QRectF& exposedSceneRect,
+                              const QGraphicsScene& scene, QWidget* widget) noexcept
+{
+    const QTransform transform = painter.worldTransform();
+    Q_ASSERT(isTransformSupported(transform));
+    const qreal scale = transform.m11();
+    const qreal devicePixelRatio = painter.device()->devicePixelRatio();
+
+    // determine the exposed tiles
+    const QRectF scaledRect(exposedSceneRect.topLeft() * scale, exposedSceneRect.size() * scale);
+    const int left = qFloor(scaledRect.left() / sTileSize);
+    const int right = qFloor(scaledRect.right() / sTileSize);
+    const int top = qFloor(scaledRect.top() / sTileSize);
+    const int bottom = qFloor(scaledRect.bottom() / sTileSize);
+
+    // blit the tiles in device coordinates to avoid any smoothing
+    const QPoint offset(qRound(transform.dx()), qRound(transform.dy()));
+    painter.save();
+    painter.setWorldTransform(QTransform());
+    for (int x = left; x <= right; ++x) {
+        for (int y = top; y <= bottom; ++y) {
+            TileKey key = {scale, x, y};
+            QPixmap* tile = mTiles.object(key);
+            if (!tile) {
+                tile = new QPixmap(renderTile(key, scene, widget, devicePixelRatio,
+                                              painter.renderHints()));
+                int cost = tile->width() * tile->height() * tile->depth() / 8 / 1024;
+                mTiles.insert(key, tile, cost);
+                tile = mTiles.object(key); // pointer is invalid if the cache was too small
+                if (!tile) continue;
+            }
+            painter.drawPixmap(QPoint(x * sTileSize, y * sTileSize) + offset, *tile);
+        }
+    }
+    painter.restore();
+}
+
+void GraphicsTileCache::invalidate(const QRectF& sceneRect) noexcept
+{
+    foreach (const TileKey& key, mTiles.keys()) {
+        // add a margin of one device pixel because antialiasing may exceed bounding rects
+        const qreal margin = qreal(1) / key.scale;
+        if (getTileSceneRect(key).adjusted(-margin, -margin, margin, margin).intersects(sceneRect)) {
+            mTiles.remove(key);
+        }
+    }
+}
+
+void GraphicsTileCache::clear() noexcept
+{
+    mTiles.clear();
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+bool GraphicsTileCache::isTransformSupported(const QTransform& transform) noexcept
+{
+    return (transform.type() <= QTransform::TxScale) && (transform.m11() > 0)
+        && (transform.m11() == transform.m22());
+}
+
+bool GraphicsTileCache::isCacheable(const QGraphicsItem& item) noexcept
+{
+    for (const QGraphicsItem* i = &item; i; i = i->parentItem()) {
+        if (i->data(sNotCacheableDataKey).toBool()) return false;
+        if (i->flags().testFlag(QGraphicsItem::ItemIgnoresTransformations)) return false;
+    }
+    return true;
+}
+
+void GraphicsTileCache::setCacheable(QGraphicsItem& item, bool cacheable) noexcept
+{
+    item.setData(sNotCacheableDataKey, !cacheable);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QRectF GraphicsTileCache::getTileSceneRect(const TileKey& key) noexcept
+{
+    const qreal size = sTileSize / key.scale;
+    return QRectF(key.x * size, key.y * size, size, size);
+}
+
+QPixmap GraphicsTileCache::renderTile(const TileKey& key, const QGraphicsScene& scene,
+                                      QWidget* widget, qreal devicePixelRatio,
+                                      QPainter::RenderHints hints) noexcept
+{
+    QPixmap pixmap(QSize(sTileSize, sTileSize) * devicePixelRatio);
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    const QTransform tileTransform = QTransform::fromScale(key.scale, key.scale)
+        * QTransform::fromTranslate(-key.x * sTileSize, -key.y * sTileSize);
+    QPainter painter(&pixmap);
+    painter.setRenderHints(hints);
+    foreach (QGraphicsItem* item, scene.items(getTileSceneRect(key),
+             Qt::IntersectsItemBoundingRect, Qt::AscendingOrder)) {
+        if ((!item->isVisible()) || (!isCacheable(*item))) continue;
+        if (item->flags().testFlag(QGraphicsItem::ItemHasNoContents)) continue;
+
+        QStyleOptionGraphicsItem option;
+        option.state = QStyle::State_None;
+        if (item->isEnabled()) option.state |= QStyle::State_Enabled;
+        if (item->isSelected()) option.state |= QStyle::State_Selected;
+        option.exposedRect = item->boundingRect();
+        if (item->flags().testFlag(QGraphicsItem::ItemUsesExtendedStyleOption)) {
+            // large items (e.g. batches) only need to paint the area of this tile
+            option.exposedRect &= item->mapRectFromScene(getTileSceneRect(key));
+        }
+        option.rect = option.exposedRect.toAlignedRect();
+        if (widget) option.palette = widget->palette();
+
+        painter.save();
+        painter.setTransform(item->sceneTransform() * tileTransform);
+        painter.setOpacity(item->effectiveOpacity());
+        item->paint(&painter, &option, widget);
+        painter.restore();
+    }
+    return pixmap;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,141 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GRAPHICSTILECACHE_H
+#define LIBREPCB_GRAPHICSTILECACHE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include <cstring>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class GraphicsTileCache
+ ****************************************************************************************/
+
+/**
+ * @brief A cache of rasterized tiles of all static items of a QGraphicsScene
+ *
+ * The scene is divided into square tiles of #sTileSize device pixels. Every tile is
+ * rendered once into a transparent pixmap and afterwards only blitted, until items
+ * within the tile change and #invalidate() is called for their bounding rects. Tiles
+ * are keyed by the zoom level, so zooming back to a previous level reuses the tiles
+ * as long as they were not evicted from the cache.
+ *
+ * Items which change very often (e.g. the selection rectangle or items following the
+ * cursor) should be marked with #setCacheable() to be painted directly instead.
+ *
+ * Only transformations which do scale (uniformly) and translate are supported, see
+ * #isTransformSupported().
+ */
+class GraphicsTileCache final
+{
+    public:
+
+        // Constructors / Destructor
+        GraphicsTileCache(const GraphicsTileCache& other) = delete;
+        GraphicsTileCache() noexcept;
+        ~GraphicsTileCache() noexcept;
+
+        // Getters
+        int getTileCount() const noexcept {return mTiles.count();}
+
+        // General Methods
+
+        /**
+         * @brief Paint the cached tiles, render missing tiles before
+         *
+         * @param painter           The painter to paint on. Its world transformation
+         *                          must map scene coordinates to device coordinates.
+         * @param exposedSceneRect  The scene area to paint
+         * @param scene             The scene to render missing tiles from
+         * @param widget            The widget passed to QGraphicsItem::paint()
+         */
+        void paint(QPainter& painter, const QRectF& exposedSceneRect,
+                   const QGraphicsScene& scene, QWidget* widget) noexcept;
+
+        /**
+         * @brief Remove all tiles (of all zoom levels) which intersect a scene area
+         *
+         * @param sceneRect     The scene area which has changed
+         */
+        void invalidate(const QRectF& sceneRect) noexcept;
+
+        /**
+         * @brief Remove all tiles
+         */
+        void clear() noexcept;
+
+        // Operator Overloadings
+        GraphicsTileCache& operator=(const GraphicsTileCache& rhs) = delete;
+
+        // Static Methods
+        static bool isTransformSupported(const QTransform& transform) noexcept;
+        static bool isCacheable(const QGraphicsItem& item) noexcept;
+        static void setCacheable(QGraphicsItem& item, bool cacheable) noexcept;
+
+        // Static Variables
+        static constexpr int sTileSize = 256; ///< in device independent pixels
+
+
+    private: // Types
+
+        struct TileKey {
+            double scale;
+            int x;
+            int y;
+
+            bool operator==(const TileKey& rhs) const noexcept {
+                return (scale == rhs.scale) && (x == rhs.x) && (y == rhs.y);
+            }
+        };
+
+        friend uint qHash(const TileKey& key, uint seed) noexcept {
+            quint64 scaleBits;
+            static_assert(sizeof(scaleBits) == sizeof(key.scale), "unexpected size of qreal");
+            std::memcpy(&scaleBits, &key.scale, sizeof(scaleBits));
+            return ::qHash(scaleBits, seed) ^ ::qHash(qMakePair(key.x, key.y), seed);
+        }
+
+
+    private: // Methods
+        static QRectF getTileSceneRect(const TileKey& key) noexcept;
+        static QPixmap renderTile(const TileKey& key, const QGraphicsScene& scene,
+                                  QWidget* widget, qreal devicePixelRatio,
+                                  QPainter::RenderHints hints) noexcept;
+
+
+    private: // Data
+        QCache<TileKey, QPixmap> mTiles; ///< the cost of a tile is its size in kB
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_GRAPHICSTILECACHE_H
@@ -24,7 +24,9 @@
 #include <QtWidgets>
 #include "QtOpenGL"
 #include "graphicsview.h"
+#include "graphicslayer.h"
 #include "graphicsscene.h"
+#include "graphicstilecache.h"
 #include "if_graphicsvieweventhandler.h"
 #include "../gridproperties.h"
 
@@ -40,7 +42,7 @@ namespace librepcb {
 GraphicsView::GraphicsView(QWidget* parent, IF_GraphicsViewEventHandler* eventHandler) noexcept :
     QGraphicsView(parent), mEventHandlerObject(eventHandler), mScene(nullptr),
     mZoomAnimation(nullptr), mGridProperties(new GridProperties()), mOriginCrossVisible(true),
-    mUseOpenGl(false), mPanningActive(false)
+    mUseOpenGl(false), mPanningActive(false), mTileCache(nullptr), mTileCacheActive(false)
 {
     setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
     setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
@@ -57,6 +59,7 @@ GraphicsView::GraphicsView(QWidget* parent, IF_GraphicsViewEventHandler* eventHa
 
 GraphicsView::~GraphicsView() noexcept
 {
+    delete mTileCache;          mTileCache = nullptr;
     delete mZoomAnimation;      mZoomAnimation = nullptr;
     delete mGridProperties;     mGridProperties = nullptr;
 }
@@ -86,6 +89,23 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept
     }
 }
 
+void GraphicsView::setUseTileCache(bool useTileCache) noexcept
+{
+    if (useTileCache != getUseTileCache())
+    {
+        if (useTileCache) {
+            mTileCache = new GraphicsTileCache();
+        } else {
+            delete mTileCache;
+            mTileCache = nullptr;
+        }
+        // needed to get drawItems() called, see drawItems()
+        setOptimizationFlag(QGraphicsView::IndirectPainting, useTileCache);
+        updateSceneConnection();
+        viewport()->update();
+    }
+}
+
 void GraphicsView::setGridProperties(const GridProperties& properties) noexcept
 {
     *mGridProperties = properties;
@@ -94,9 +114,14 @@ void GraphicsView::setGridProperties(const GridProperties& properties) noexcept
 
 void GraphicsView::setScene(GraphicsScene* scene) noexcept
 {
-    if (mScene) mScene->removeEventFilter(this);
+    if (mScene) {
+        mScene->removeEventFilter(this);
+        disconnect(mScene, &QGraphicsScene::changed, this, &GraphicsView::sceneChanged);
+    }
     mScene = scene;
     if (mScene) mScene->installEventFilter(this);
+    if (mTileCache) mTileCache->clear();
+    updateSceneConnection();
     QGraphicsView::setScene(mScene);
 }
 
@@ -116,6 +141,19 @@ void GraphicsView::setEventHandlerObject(IF_GraphicsViewEventHandler* eventHandl
     mEventHandlerObject = eventHandler;
 }
 
+void GraphicsView::setObservedLayers(const QList<GraphicsLayer*>& layers) noexcept
+{
+    foreach (const QMetaObject::Connection& connection, mLayerConnections) {
+        disconnect(connection);
+    }
+    mLayerConnections.clear();
+    foreach (const GraphicsLayer* layer, layers) {
+        mLayerConnections.append(connect(layer, &GraphicsLayer::attributesChanged,
+                                         this, &GraphicsView::invalidateTileCache));
+    }
+    invalidateTileCache();
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -187,6 +225,14 @@ void GraphicsView::zoomAll() noexcept
     mZoomAnimation->start();
 }
 
+void GraphicsView::invalidateTileCache() noexcept
+{
+    if (mTileCache) {
+        mTileCache->clear();
+        viewport()->update();
+    }
+}
+
 /*****************************************************************************************
  *  Private Slots
  ****************************************************************************************/
@@ -197,6 +243,49 @@ void GraphicsView::zoomAnimationValueChanged(const QVariant& value) noexcept
         fitInView(value.toRectF(), Qt::KeepAspectRatio); // zoom smoothly
 }
 
+void GraphicsView::sceneChanged(const QList<QRectF>& region) noexcept
+{
+    if (!mTileCache) return;
+    foreach (const QRectF& rect, region) {
+        if (!isTransientItemRect(rect)) {
+            mTileCache->invalidate(rect);
+        }
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void GraphicsView::updateSceneConnection() noexcept
+{
+    // Note: Connecting to QGraphicsScene::changed() makes updating the scene a bit
+    // slower, so it is only done if really needed.
+    if (!mScene) return;
+    disconnect(mScene, &QGraphicsScene::changed, this, &GraphicsView::sceneChanged);
+    if (mTileCache) {
+        connect(mScene, &QGraphicsScene::changed, this, &GraphicsView::sceneChanged);
+    }
+}
+
+bool GraphicsView::isTransientItemRect(const QRectF& rect) const noexcept
+{
+    // Changes of transient items must not invalidate the tile cache, otherwise a
+    // selection rectangle or an item following the cursor would make the cache
+    // useless. Since QGraphicsScene::changed() only reports the old and new bounding
+    // rects of changed items, these rects are compared with the bounding rects of
+    // transient items at the last paint event and now.
+    if (mTransientItemRects.contains(rect)) {
+        return true;
+    }
+    foreach (const QGraphicsItem* item, mScene->items(rect, Qt::IntersectsItemBoundingRect)) {
+        if ((!GraphicsTileCache::isCacheable(*item)) && (item->sceneBoundingRect() == rect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /*****************************************************************************************
  *  Inherited from QGraphicsView
  ****************************************************************************************/
@@ -311,6 +400,15 @@ void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
                 break;
         }
     }
+
+    // draw all static items from the tile cache (transient items are drawn in drawItems())
+    mTileCacheActive = mTileCache && mScene
+        && (mZoomAnimation->state() != QAbstractAnimation::Running) // avoid rendering tiles of each step
+        && GraphicsTileCache::isTransformSupported(painter->worldTransform());
+    if (mTileCacheActive) {
+        painter->setOpacity(1);
+        mTileCache->paint(*painter, rect, *mScene, viewport());
+    }
 }
 
 void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
@@ -329,6 +427,30 @@ void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
     }
 }
 
+void GraphicsView::drawItems(QPainter* painter, int numItems, QGraphicsItem* items[],
+                             const QStyleOptionGraphicsItem options[])
+{
+    // Note: This method is only called if QGraphicsView::IndirectPainting is set.
+    mTransientItemRects.clear();
+    if (!mTileCacheActive) {
+        QGraphicsView::drawItems(painter, numItems, items, options);
+        return;
+    }
+
+    // static items were already drawn from the tile cache in drawBackground()
+    QVector<QGraphicsItem*> transientItems;
+    QVector<QStyleOptionGraphicsItem> transientOptions;
+    for (int i = 0; i < numItems; ++i) {
+        if (!GraphicsTileCache::isCacheable(*items[i])) {
+            transientItems.append(items[i]);
+            transientOptions.append(options[i]);
+            mTransientItemRects.append(items[i]->sceneBoundingRect());
+        }
+    }
+    QGraphicsView::drawItems(painter, transientItems.count(), transientItems.data(),
+                             transientOptions.constData());
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
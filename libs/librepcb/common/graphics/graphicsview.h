@@ -33,7 +33,9 @@
 namespace librepcb {
 
 class IF_GraphicsViewEventHandler;
+class GraphicsLayer;
 class GraphicsScene;
+class GraphicsTileCache;
 class GridProperties;
 
 /*****************************************************************************************
@@ -58,16 +60,29 @@ class GraphicsView final : public QGraphicsView
         GraphicsScene* getScene() const noexcept {return mScene;}
         QRectF getVisibleSceneRect() const noexcept;
         bool getUseOpenGl() const noexcept {return mUseOpenGl;}
+        bool getUseTileCache() const noexcept {return mTileCache != nullptr;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
 
         // Setters
         void setUseOpenGl(bool useOpenGl) noexcept;
+        void setUseTileCache(bool useTileCache) noexcept;
         void setGridProperties(const GridProperties& properties) noexcept;
         void setScene(GraphicsScene* scene) noexcept;
         void setVisibleSceneRect(const QRectF& rect) noexcept;
         void setOriginCrossVisible(bool visible) noexcept;
         void setEventHandlerObject(IF_GraphicsViewEventHandler* eventHandler) noexcept;
 
+        /**
+         * @brief Set the layers whose attributes affect the appearance of the scene
+         *
+         * Changing the visibility or color of a layer does not necessarily notify the
+         * scene about the affected items, so the whole tile cache is invalidated when
+         * any attribute of these layers changes.
+         *
+         * @param layers    The layers used by the items of the current scene
+         */
+        void setObservedLayers(const QList<GraphicsLayer*>& layers) noexcept;
+
         // General Methods
         Point mapGlobalPosToScenePos(const QPoint& globalPosPx, bool boundToView,
                                      bool mapToGrid) const noexcept;
@@ -80,6 +95,7 @@ class GraphicsView final : public QGraphicsView
         void zoomIn() noexcept;
         void zoomOut() noexcept;
         void zoomAll() noexcept;
+        void invalidateTileCache() noexcept;
 
 
     signals:
@@ -95,6 +111,7 @@ class GraphicsView final : public QGraphicsView
 
         // Private Slots
         void zoomAnimationValueChanged(const QVariant& value) noexcept;
+        void sceneChanged(const QList<QRectF>& region) noexcept;
 
 
     private:
@@ -103,10 +120,16 @@ class GraphicsView final : public QGraphicsView
         GraphicsView(const GraphicsView& other) = delete;
         GraphicsView& operator=(const GraphicsView& rhs) = delete;
 
+        // Private Methods
+        void updateSceneConnection() noexcept;
+        bool isTransientItemRect(const QRectF& rect) const noexcept;
+
         // Inherited Methods
         bool eventFilter(QObject* obj, QEvent* event);
         void drawBackground(QPainter* painter, const QRectF& rect);
         void drawForeground(QPainter* painter, const QRectF& rect);
+        void drawItems(QPainter* painter, int numItems, QGraphicsItem* items[],
+                       const QStyleOptionGraphicsItem options[]);
 
 
         // General Attributes
@@ -119,6 +142,12 @@ class GraphicsView final : public QGraphicsView
         volatile bool mPanningActive;
         QCursor mCursorBeforePanning;
 
+        // Tile Cache
+        GraphicsTileCache* mTileCache; ///< nullptr if the tile cache is disabled
+        bool mTileCacheActive; ///< whether the tile cache is used for the current paint
+        QVector<QRectF> mTransientItemRects; ///< scene rects of the last painted transient items
+        QList<QMetaObject::Connection> mLayerConnections; ///< see #setObservedLayers()
+
         // Static Variables
         static constexpr qreal sZoomStepFactor = 1.3;
 };
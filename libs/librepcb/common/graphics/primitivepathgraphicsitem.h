@@ -77,6 +77,12 @@ class PrimitivePathGraphicsItem : public QGraphicsItem, public IF_GraphicsLayerO
         PrimitivePathGraphicsItem& operator=(const PrimitivePathGraphicsItem& rhs) = delete;
 
 
+    protected: // Methods
+        const QPen& getPen(bool highlighted) const noexcept {
+            return highlighted ? mPenHighlighted : mPen;
+        }
+
+
     private: // Methods
         void updateColors() noexcept;
         void updateBoundingRectAndShape() noexcept;
@@ -49,7 +49,7 @@ StrokeTextGraphicsItem::StrokeTextGraphicsItem(StrokeText& text,
     // set text properties
     setPosition(mText.getPosition());
     setLineWidth(mText.getStrokeWidth());
-    setPath(Path::toQPainterPathPx(mText.getPaths()));
+    updatePaths(mText.getPaths());
     setFlag(QGraphicsItem::ItemIsSelectable, true);
     setZValue(5);
     updateLayer(mText.getLayerName());
@@ -73,6 +73,26 @@ QPainterPath StrokeTextGraphicsItem::shape() const noexcept
     return PrimitivePathGraphicsItem::shape() + mOriginCrossGraphicsItem->shape();
 }
 
+void StrokeTextGraphicsItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) noexcept
+{
+    // text height in screen pixels below which the text is not readable anyway
+    static const qreal sMinReadableHeight = 4;
+
+    // Drawing all the strokes of a tiny text is quite expensive, so on the screen only a
+    // box is drawn in this case. Printing or exporting (no widget) draws the full text.
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    if (widget && (mText.getHeight()->toPx() * lod < sMinReadableHeight)) {
+        const QPen& pen = getPen(option->state.testFlag(QStyle::State_Selected));
+        if (pen.style() != Qt::NoPen) {
+            QColor color = pen.color();
+            color.setAlphaF(color.alphaF() / 2);
+            painter->fillRect(mPathsRect, color);
+        }
+    } else {
+        PrimitivePathGraphicsItem::paint(painter, option, widget);
+    }
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -143,7 +163,14 @@ void StrokeTextGraphicsItem::strokeTextAutoRotateChanged(bool newAutoRotate) noe
 
 void StrokeTextGraphicsItem::strokeTextPathsChanged(const QVector<Path>& paths) noexcept
 {
-    setPath(Path::toQPainterPathPx(paths));
+    updatePaths(paths);
+}
+
+void StrokeTextGraphicsItem::updatePaths(const QVector<Path>& paths) noexcept
+{
+    QPainterPath path = Path::toQPainterPathPx(paths);
+    mPathsRect = path.boundingRect();
+    setPath(path);
 }
 
 void StrokeTextGraphicsItem::updateLayer(const GraphicsLayerName& layerName) noexcept
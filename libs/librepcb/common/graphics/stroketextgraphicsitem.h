@@ -61,6 +61,7 @@ class StrokeTextGraphicsItem final : public PrimitivePathGraphicsItem,
 
         // Inherited from QGraphicsItem
         QPainterPath shape() const noexcept override;
+        void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0) noexcept override;
 
         // Operator Overloadings
         StrokeTextGraphicsItem& operator=(const StrokeTextGraphicsItem& rhs) = delete;
@@ -79,6 +80,7 @@ class StrokeTextGraphicsItem final : public PrimitivePathGraphicsItem,
         void strokeTextMirroredChanged(bool mirrored) noexcept override;
         void strokeTextAutoRotateChanged(bool newAutoRotate) noexcept override;
         void strokeTextPathsChanged(const QVector<Path>& paths) noexcept override;
+        void updatePaths(const QVector<Path>& paths) noexcept;
         void updateLayer(const GraphicsLayerName& layerName) noexcept;
         void updateTransform() noexcept;
         QVariant itemChange(GraphicsItemChange change, const QVariant& value) noexcept override;
@@ -88,6 +90,7 @@ class StrokeTextGraphicsItem final : public PrimitivePathGraphicsItem,
         StrokeText& mText;
         const IF_GraphicsLayerProvider& mLayerProvider;
         QScopedPointer<OriginCrossGraphicsItem> mOriginCrossGraphicsItem;
+        QRectF mPathsRect; ///< drawn instead of the paths if the text is very small
 };
 
 /*****************************************************************************************
@@ -79,6 +79,23 @@ void UndoCommand::redo()
     mRedoCount++;
 }
 
+bool UndoCommand::canMergeWith(const UndoCommand& other) const noexcept
+{
+    Q_UNUSED(other);
+    return false;
+}
+
+void UndoCommand::mergeWith(const UndoCommand& other) noexcept
+{
+    Q_UNUSED(other);
+    Q_ASSERT(false); // must not be called if canMergeWith() returns false
+}
+
+qint64 UndoCommand::getEstimatedMemoryUsage() const noexcept
+{
+    return sizeof(*this) + mText.capacity() * sizeof(QChar);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
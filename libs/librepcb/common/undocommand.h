@@ -102,6 +102,40 @@ class UndoCommand
          */
         virtual void redo() final;
 
+        /**
+         * @brief Check whether a newer command can be merged into this command
+         *
+         * The librepcb::UndoStack merges consecutive commands into a single entry if this
+         * method returns true, e.g. to keep only one entry for repeated moves of the same
+         * object. Both commands are currently executed when this method is called.
+         *
+         * @note The default implementation returns false (no merging supported).
+         *
+         * @param other     The command which was executed directly after this command
+         *
+         * @return True if #mergeWith() can be called with @p other
+         */
+        virtual bool canMergeWith(const UndoCommand& other) const noexcept;
+
+        /**
+         * @brief Take over the changes of a newer command
+         *
+         * Afterwards, undoing this command must also revert all changes of @p other,
+         * and redoing it must also apply them. @p other will be deleted without being
+         * undone.
+         *
+         * @param other     A command for which #canMergeWith() returned true
+         */
+        virtual void mergeWith(const UndoCommand& other) noexcept;
+
+        /**
+         * @brief Get the (estimated) number of bytes this command occupies in memory
+         *
+         * Used by the librepcb::UndoStack to limit its memory usage. Commands which hold
+         * a lot of data should override this method.
+         */
+        virtual qint64 getEstimatedMemoryUsage() const noexcept;
+
         // Operator Overloadings
         UndoCommand& operator=(const UndoCommand& rhs) = delete;
 
@@ -20,6 +20,7 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <typeinfo>
 #include <QtCore>
 #include "undocommandgroup.h"
 #include "scopeguardlist.h"
@@ -70,6 +71,39 @@ void UndoCommandGroup::appendChild(UndoCommand* cmd)
     }
 }
 
+bool UndoCommandGroup::canMergeWith(const UndoCommand& other) const noexcept
+{
+    const UndoCommandGroup* group = dynamic_cast<const UndoCommandGroup*>(&other);
+    if ((!group) || (typeid(*group) != typeid(*this)) || (group->getText() != getText())
+        || (group->mChilds.count() != mChilds.count()) || (mChilds.isEmpty())) {
+        return false;
+    }
+    for (int i = 0; i < mChilds.count(); ++i) {
+        if (!mChilds.at(i)->canMergeWith(*group->mChilds.at(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void UndoCommandGroup::mergeWith(const UndoCommand& other) noexcept
+{
+    const UndoCommandGroup* group = dynamic_cast<const UndoCommandGroup*>(&other);
+    Q_ASSERT(group && (group->mChilds.count() == mChilds.count()));
+    for (int i = 0; i < mChilds.count(); ++i) {
+        mChilds.at(i)->mergeWith(*group->mChilds.at(i));
+    }
+}
+
+qint64 UndoCommandGroup::getEstimatedMemoryUsage() const noexcept
+{
+    qint64 size = UndoCommand::getEstimatedMemoryUsage();
+    foreach (const UndoCommand* cmd, mChilds) {
+        size += cmd->getEstimatedMemoryUsage();
+    }
+    return size;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
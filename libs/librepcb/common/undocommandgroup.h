@@ -72,6 +72,20 @@ class UndoCommandGroup : public UndoCommand
          */
         void appendChild(UndoCommand* cmd);
 
+        /**
+         * @brief Groups can be merged if all their childs can be merged pairwise
+         *
+         * Both groups must be of the same type, have the same text and the same count of
+         * childs.
+         */
+        bool canMergeWith(const UndoCommand& other) const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        void mergeWith(const UndoCommand& other) noexcept override;
+
+        /// @copydoc UndoCommand::getEstimatedMemoryUsage()
+        qint64 getEstimatedMemoryUsage() const noexcept override;
+
         // Operator Overloadings
         UndoCommandGroup& operator=(const UndoCommandGroup& rhs) = delete;
 
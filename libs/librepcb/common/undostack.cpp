@@ -75,7 +75,9 @@ void UndoStackTransaction::commit()
  ****************************************************************************************/
 
 UndoStack::UndoStack() noexcept :
-    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr)
+    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0),
+    mMaxCommandCount(sDefaultMaxCommandCount), mMaxMemoryUsage(sDefaultMaxMemoryUsage),
+    mActiveCommandGroup(nullptr)
 {
 }
 
@@ -137,6 +139,13 @@ void UndoStack::setClean() noexcept
     emit cleanChanged(true);
 }
 
+void UndoStack::setLimits(int maxCount, qint64 maxBytes) noexcept
+{
+    mMaxCommandCount = qMax(maxCount, 0);
+    mMaxMemoryUsage = qMax(maxBytes, qint64(0));
+    enforceLimits();
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -166,9 +175,16 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd)
         }
         Q_ASSERT(mCurrentIndex == mCommands.count());
 
-        // add command to the command stack
-        mCommands.append(cmdScopeGuard.take()); // move ownership of "cmd" to "mCommands"
-        mCurrentIndex++;
+        if ((!forceKeepCmd) && mergeIntoPreviousCmd(*cmd)) {
+            // the previous command took over the changes, so "cmd" is no longer needed
+            cmdScopeGuard.reset();
+            cmd = mCommands.last();
+        } else {
+            // add command to the command stack
+            mCommands.append(cmdScopeGuard.take()); // move ownership of "cmd" to "mCommands"
+            mCurrentIndex++;
+            enforceLimits();
+        }
 
         // emit signals
         emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
@@ -236,6 +252,9 @@ void UndoStack::commitCmdGroup()
     // currently active command group
     mActiveCommandGroup = nullptr;
 
+    // the group may have grown a lot, so check the limits again
+    enforceLimits();
+
     // emit signals
     emit canUndoChanged(canUndo());
     emit commandGroupEnded();
@@ -347,6 +366,57 @@ void UndoStack::clear() noexcept
     emit cleanChanged(true);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool UndoStack::mergeIntoPreviousCmd(UndoCommand& cmd) noexcept
+{
+    Q_ASSERT(mCurrentIndex == mCommands.count());
+    Q_ASSERT(!isCommandGroupActive());
+
+    // do not merge into the clean state, it would get lost otherwise
+    if ((mCurrentIndex < 1) || (mCleanIndex == mCurrentIndex)) {
+        return false;
+    }
+
+    UndoCommand* previous = mCommands.at(mCurrentIndex - 1);
+    if (!previous->canMergeWith(cmd)) {
+        return false;
+    }
+    previous->mergeWith(cmd);
+    return true;
+}
+
+void UndoStack::enforceLimits() noexcept
+{
+    // count the memory usage from top to bottom to know how many commands to keep
+    int keepCount = 0;
+    qint64 memoryUsage = 0;
+    for (int i = mCommands.count() - 1; i >= 0; --i) {
+        memoryUsage += mCommands.at(i)->getEstimatedMemoryUsage();
+        bool exceeded = ((mMaxCommandCount > 0) && (keepCount >= mMaxCommandCount))
+                     || ((mMaxMemoryUsage > 0) && (memoryUsage > mMaxMemoryUsage));
+        if (exceeded && (keepCount > 0) && (i < mCurrentIndex)) {
+            break; // the newest command and redoable commands are always kept
+        }
+        ++keepCount;
+    }
+
+    // delete the oldest commands (from bottom to top, as they were created)
+    int removeCount = mCommands.count() - keepCount;
+    if (removeCount <= 0) {
+        return;
+    }
+    for (int i = 0; i < removeCount; ++i) {
+        Q_ASSERT(mCommands.first() != mActiveCommandGroup);
+        delete mCommands.takeFirst();
+    }
+    mCurrentIndex -= removeCount;
+    mCleanIndex = (mCleanIndex >= removeCount) ? (mCleanIndex - removeCount) : -1;
+    qDebug() << "Removed" << removeCount << "commands from the undo stack";
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -175,6 +175,17 @@ class UndoStack final : public QObject
         bool isCommandGroupActive() const noexcept;
 
 
+        /**
+         * @brief Get the maximum count of commands to keep (0 = unlimited)
+         */
+        int getMaxCommandCount() const noexcept {return mMaxCommandCount;}
+
+        /**
+         * @brief Get the maximum (estimated) memory usage of all commands (0 = unlimited)
+         */
+        qint64 getMaxMemoryUsage() const noexcept {return mMaxMemoryUsage;}
+
+
         // Setters
 
         /**
@@ -182,6 +193,20 @@ class UndoStack final : public QObject
          */
         void setClean() noexcept;
 
+        /**
+         * @brief Limit the count of commands and their memory usage
+         *
+         * If a limit is exceeded, the oldest commands are deleted (so they can no
+         * longer be undone). The newest command is always kept. If the clean state gets
+         * deleted that way, the stack can not become clean anymore until the next call
+         * to #setClean().
+         *
+         * @param maxCount      Maximum count of commands (0 = unlimited)
+         * @param maxBytes      Maximum estimated memory usage (0 = unlimited), see
+         *                      UndoCommand#getEstimatedMemoryUsage()
+         */
+        void setLimits(int maxCount, qint64 maxBytes) noexcept;
+
 
         // General Methods
 
@@ -196,6 +221,11 @@ class UndoStack final : public QObject
          *                  UndoCommand object after passing it to this method.
          * @param forceKeepCmd  Only for internal use!
          *
+         * @note If the previous command supports it (see UndoCommand#canMergeWith()),
+         *       the new command is merged into the previous command instead of being
+         *       pushed as a separate entry. Commands are never merged into the clean
+         *       state.
+         *
          * @throw Exception If the command is not executed successfully, this method
          *                  throws an exception and tries to keep the state of the stack
          *                  consistend (as the passed command did never exist).
@@ -290,7 +320,19 @@ class UndoStack final : public QObject
         void stateModified();
 
 
-    private:
+    public: // Constants
+
+        static const int sDefaultMaxCommandCount = 1000;
+        static const qint64 sDefaultMaxMemoryUsage = 256 * 1024 * 1024;
+
+
+    private: // Methods
+
+        bool mergeIntoPreviousCmd(UndoCommand& cmd) noexcept;
+        void enforceLimits() noexcept;
+
+
+    private: // Data
 
         /**
          * @brief This list holds all commands of the undo stack
@@ -314,6 +356,16 @@ class UndoStack final : public QObject
          */
         int mCleanIndex;
 
+        /**
+         * @brief The maximum count of commands in #mCommands (0 = unlimited)
+         */
+        int mMaxCommandCount;
+
+        /**
+         * @brief The maximum estimated memory usage of #mCommands (0 = unlimited)
+         */
+        qint64 mMaxMemoryUsage;
+
         /**
          * @brief If a command group is active at the moment, this is the pointer to it
          *
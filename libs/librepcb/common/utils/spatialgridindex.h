@@ -0,0 +1,241 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SPATIALGRIDINDEX_H
+#define LIBREPCB_SPATIALGRIDINDEX_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class SpatialGridIndex
+ ****************************************************************************************/
+
+/**
+ * @brief A uniform grid to quickly find items by their bounding rectangle
+ *
+ * Every item is registered in all grid cells which its bounding rectangle overlaps, so
+ * a lookup only needs to check the items of the cells around the requested position
+ * instead of all items. Items which would overlap very many cells are kept in a separate
+ * list which is always checked.
+ *
+ * The index only compares bounding rectangles, so the returned items are candidates
+ * which need to be checked with their exact shape by the caller.
+ *
+ * @tparam T    The (hashable) item type, typically a pointer
+ */
+template <typename T>
+class SpatialGridIndex final
+{
+    public:
+
+        // Constructors / Destructor
+        SpatialGridIndex() = delete;
+        SpatialGridIndex(const SpatialGridIndex& other) = default;
+        explicit SpatialGridIndex(qreal cellSize) noexcept : mCellSize(cellSize) {
+            Q_ASSERT(mCellSize > 0);
+        }
+        ~SpatialGridIndex() noexcept = default;
+
+        // Getters
+        int count() const noexcept {return mRects.count();}
+        bool contains(const T& item) const noexcept {return mRects.contains(item);}
+
+        /**
+         * @brief Get all items whose bounding rectangle contains a position
+         *
+         * @param pos   The position
+         *
+         * @return The found items
+         */
+        QList<T> find(const QPointF& pos) const noexcept {
+            QList<T> items;
+            foreach (const T& item, mCells.value(cellAt(pos))) {
+                if (mRects.value(item).contains(pos)) {
+                    items.append(item);
+                }
+            }
+            foreach (const T& item, mLargeItems) {
+                if (mRects.value(item).contains(pos)) {
+                    items.append(item);
+                }
+            }
+            return items;
+        }
+
+        /**
+         * @brief Get all items whose bounding rectangle intersects a rectangle
+         *
+         * @param rect  The rectangle
+         *
+         * @return The found items (each item is contained only once)
+         */
+        QList<T> find(const QRectF& rect) const noexcept {
+            QList<T> items;
+            QSet<T> found;
+            auto addItemsOfCell = [&](const QList<T>& cellItems) {
+                foreach (const T& item, cellItems) {
+                    if ((!found.contains(item)) && mRects.value(item).intersects(rect)) {
+                        found.insert(item);
+                        items.append(item);
+                    }
+                }
+            };
+            // only visit the cells within the occupied area, so even huge rects (e.g.
+            // the whole scene) don't iterate over millions of empty cells
+            Cell topLeft = cellAt(rect.topLeft());
+            Cell bottomRight = cellAt(rect.bottomRight());
+            int left = qMax(topLeft.first, mMinCell.first);
+            int top = qMax(topLeft.second, mMinCell.second);
+            int right = qMin(bottomRight.first, mMaxCell.first);
+            int bottom = qMin(bottomRight.second, mMaxCell.second);
+            if (mCells.isEmpty() || (left > right) || (top > bottom)) {
+                // no occupied cell within the rect
+            } else if (qint64(right - left + 1) * qint64(bottom - top + 1) > mCells.count()) {
+                for (auto it = mCells.constBegin(); it != mCells.constEnd(); ++it) {
+                    if ((it.key().first >= left) && (it.key().first <= right) &&
+                        (it.key().second >= top) && (it.key().second <= bottom)) {
+                        addItemsOfCell(it.value());
+                    }
+                }
+            } else {
+                for (int x = left; x <= right; ++x) {
+                    for (int y = top; y <= bottom; ++y) {
+                        addItemsOfCell(mCells.value(Cell(x, y)));
+                    }
+                }
+            }
+            foreach (const T& item, mLargeItems) {
+                if (mRects.value(item).intersects(rect)) {
+                    items.append(item);
+                }
+            }
+            return items;
+        }
+
+        // General Methods
+
+        /**
+         * @brief Add an item or update the bounding rectangle of an already added item
+         *
+         * @param item  The item
+         * @param rect  The bounding rectangle of the item (normalized)
+         */
+        void insert(const T& item, const QRectF& rect) noexcept {
+            if (mRects.contains(item)) {
+                if (mRects.value(item) == rect) {
+                    return; // nothing has changed
+                }
+                remove(item);
+            }
+            mRects.insert(item, rect);
+            Cell topLeft = cellAt(rect.topLeft());
+            Cell bottomRight = cellAt(rect.bottomRight());
+            qint64 cellCount = qint64(bottomRight.first - topLeft.first + 1)
+                             * qint64(bottomRight.second - topLeft.second + 1);
+            if (cellCount > sMaxCellsPerItem) {
+                mLargeItems.append(item);
+                return;
+            }
+            if (mCells.isEmpty()) {
+                mMinCell = topLeft;
+                mMaxCell = bottomRight;
+            } else {
+                mMinCell = Cell(qMin(mMinCell.first, topLeft.first),
+                                qMin(mMinCell.second, topLeft.second));
+                mMaxCell = Cell(qMax(mMaxCell.first, bottomRight.first),
+                                qMax(mMaxCell.second, bottomRight.second));
+            }
+            for (int x = topLeft.first; x <= bottomRight.first; ++x) {
+                for (int y = topLeft.second; y <= bottomRight.second; ++y) {
+                    mCells[Cell(x, y)].append(item);
+                }
+            }
+        }
+
+        void remove(const T& item) noexcept {
+            if (!mRects.contains(item)) {
+                return;
+            }
+            QRectF rect = mRects.take(item);
+            if (mLargeItems.removeOne(item)) {
+                return;
+            }
+            Cell topLeft = cellAt(rect.topLeft());
+            Cell bottomRight = cellAt(rect.bottomRight());
+            for (int x = topLeft.first; x <= bottomRight.first; ++x) {
+                for (int y = topLeft.second; y <= bottomRight.second; ++y) {
+                    auto it = mCells.find(Cell(x, y));
+                    Q_ASSERT(it != mCells.end());
+                    it->removeOne(item);
+                    if (it->isEmpty()) {
+                        mCells.erase(it);
+                    }
+                }
+            }
+        }
+
+        void clear() noexcept {
+            mRects.clear();
+            mCells.clear();
+            mLargeItems.clear();
+        }
+
+        // Operator Overloadings
+        SpatialGridIndex& operator=(const SpatialGridIndex& rhs) = default;
+
+
+    private: // Types
+
+        typedef QPair<int, int> Cell; ///< x and y index of a grid cell
+
+
+    private: // Methods
+
+        Cell cellAt(const QPointF& pos) const noexcept {
+            return Cell(qFloor(pos.x() / mCellSize), qFloor(pos.y() / mCellSize));
+        }
+
+
+    private: // Data
+
+        qreal mCellSize;
+        QHash<T, QRectF> mRects; ///< the bounding rectangles of all items
+        QHash<Cell, QList<T>> mCells; ///< the items of all non-empty cells
+        QList<T> mLargeItems; ///< items which overlap more than #sMaxCellsPerItem cells
+        Cell mMinCell; ///< top left of all non-empty cells (only grows until emptied)
+        Cell mMaxCell; ///< bottom right of all non-empty cells (only grows until emptied)
+
+        static const int sMaxCellsPerItem = 64;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_SPATIALGRIDINDEX_H
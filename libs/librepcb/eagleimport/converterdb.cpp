@@ -21,7 +21,9 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtSql>
 #include "converterdb.h"
+#include <librepcb/common/sqlitedatabase.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -33,13 +35,55 @@ namespace eagleimport {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-ConverterDb::ConverterDb(const FilePath& ini) noexcept :
-    mIniFile(ini.toStr(), QSettings::IniFormat)
+ConverterDb::ConverterDb(const FilePath& filepath) :
+    mStorage(new Storage())
+{
+    // legacy INI files are replaced by a database next to them
+    FilePath dbFilePath = filepath;
+    FilePath iniFilePath;
+    if (filepath.getSuffix().toLower() == "ini") {
+        dbFilePath = filepath.getParentDir().getPathTo(filepath.getCompleteBasename() % ".sqlite");
+        iniFilePath = filepath;
+    }
+
+    // open the database
+    bool isNewDatabase = !dbFilePath.isExistingFile();
+    mDatabase.reset(new SQLiteDatabase(dbFilePath)); // can throw
+    mDatabase->exec("CREATE TABLE IF NOT EXISTS uuids ("
+                    "`category` TEXT NOT NULL, "
+                    "`key` TEXT NOT NULL, "
+                    "`uuid` TEXT NOT NULL, "
+                    "PRIMARY KEY(`category`, `key`))"); // can throw
+
+    // load all UUIDs
+    QSqlQuery query = mDatabase->prepareQuery("SELECT category, key, uuid FROM uuids");
+    mDatabase->exec(query); // can throw
+    while (query.next()) {
+        QString key = query.value(0).toString() % '/' % query.value(1).toString();
+        mStorage->uuids.insert(key, Uuid::fromString(query.value(2).toString())); // can throw
+    }
+
+    // migrate the legacy INI file
+    if (isNewDatabase && iniFilePath.isExistingFile()) {
+        importIniFile(iniFilePath); // can throw
+        save(); // can throw
+    }
+}
+
+ConverterDb::ConverterDb(const ConverterDb& other, const FilePath& libFilePath) noexcept :
+    mStorage(other.mStorage), mLibFilePath(libFilePath)
 {
 }
 
 ConverterDb::~ConverterDb() noexcept
 {
+    if (mDatabase) {
+        try {
+            save(); // can throw
+        } catch (const Exception& e) {
+            qCritical() << "Could not save the converter database:" << e.getMsg();
+        }
+    }
 }
 
 /*****************************************************************************************
@@ -99,6 +143,42 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName, const QString& dev
     return getOrCreateUuid("devices_to_devices", deviceSetName, deviceName);
 }
 
+QSet<QString> ConverterDb::getLibraryFilenames() const noexcept
+{
+    QMutexLocker locker(&mStorage->mutex);
+    QSet<QString> filenames;
+    foreach (const QString& key, mStorage->uuids.keys()) {
+        QString name = key.section('/', 1, -1);
+        int index = name.indexOf(".lbr");
+        if (index >= 0) {
+            filenames.insert(name.left(index + 4));
+        }
+    }
+    return filenames;
+}
+
+void ConverterDb::save()
+{
+    Q_ASSERT(mDatabase);
+    QMutexLocker locker(&mStorage->mutex);
+    if (mStorage->newKeys.isEmpty()) {
+        return;
+    }
+
+    SQLiteDatabase::TransactionScopeGuard transactionGuard(*mDatabase); // can throw
+    QSqlQuery query = mDatabase->prepareQuery(
+        "INSERT OR REPLACE INTO uuids (category, key, uuid) "
+        "VALUES (:category, :key, :uuid)"); // can throw
+    foreach (const QString& key, mStorage->newKeys) {
+        query.bindValue(":category", key.section('/', 0, 0));
+        query.bindValue(":key", key.section('/', 1, -1));
+        query.bindValue(":uuid", mStorage->uuids.value(key).toStr());
+        mDatabase->exec(query); // can throw
+    }
+    transactionGuard.commit(); // can throw
+    mStorage->newKeys.clear();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -106,26 +186,52 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName, const QString& dev
 Uuid ConverterDb::getOrCreateUuid(const QString& cat, const QString& key1,
                                   const QString& key2)
 {
-    QString allowedChars("_-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
+    QString key = cat % '/' % escapeKey(mLibFilePath.getFilename() % '_' % key1 % '_' % key2);
 
-    QString settingsKey = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
-    settingsKey.replace("{", "");
-    settingsKey.replace("}", "");
-    settingsKey.replace(" ", "_");
-    for (int i=0; i<settingsKey.length(); i++)
-    {
-        if (!allowedChars.contains(settingsKey[i]))
-            settingsKey.replace(i, 1, QString("__U%1__").arg(QString::number(settingsKey[i].unicode(), 16).toUpper()));
+    QMutexLocker locker(&mStorage->mutex);
+    auto it = mStorage->uuids.constFind(key);
+    if (it != mStorage->uuids.constEnd()) {
+        return it.value();
     }
-    settingsKey.prepend(cat % '/');
-
     Uuid uuid = Uuid::createRandom();
-    QString value = mIniFile.value(settingsKey).toString();
-    if (!value.isEmpty()) uuid = Uuid::fromString(value); // can throw
-    mIniFile.setValue(settingsKey, uuid.toStr());
+    mStorage->uuids.insert(key, uuid);
+    mStorage->newKeys.append(key);
     return uuid;
 }
 
+void ConverterDb::importIniFile(const FilePath& ini)
+{
+    QSettings settings(ini.toStr(), QSettings::IniFormat);
+    foreach (const QString& key, settings.allKeys()) {
+        QString value = settings.value(key).toString();
+        if ((!key.contains('/')) || value.isEmpty()) continue;
+        if (!mStorage->uuids.contains(key)) {
+            mStorage->newKeys.append(key);
+        }
+        mStorage->uuids.insert(key, Uuid::fromString(value)); // can throw
+    }
+}
+
+QString ConverterDb::escapeKey(const QString& key) noexcept
+{
+    // same escaping as used for the keys of the legacy INI files, so imported keys match
+    QString escaped;
+    escaped.reserve(key.length());
+    foreach (const QChar& c, key) {
+        if ((c == '{') || (c == '}')) {
+            continue;
+        } else if (c == ' ') {
+            escaped.append('_');
+        } else if ((c == '_') || (c == '-') || (c == '.') || ((c >= '0') && (c <= '9')) ||
+                   ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z'))) {
+            escaped.append(c);
+        } else {
+            escaped.append(QString("__U%1__").arg(QString::number(c.unicode(), 16).toUpper()));
+        }
+    }
+    return escaped;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
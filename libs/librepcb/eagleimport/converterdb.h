@@ -23,6 +23,7 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <memory>
 #include <QtCore>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/uuid.h>
@@ -33,6 +34,7 @@
 namespace librepcb {
 
 class FilePath;
+class SQLiteDatabase;
 
 namespace eagleimport {
 
@@ -42,6 +44,23 @@ namespace eagleimport {
 
 /**
  * @brief The ConverterDb class
+ *
+ * Maps the names of Eagle library elements to the UUIDs of the converted LibrePCB
+ * elements, so that converting the same Eagle library again results in the same UUIDs.
+ *
+ * The mapping is stored in a SQLite database, but all lookups are done in a hash table
+ * which is loaded completely when opening the database. New UUIDs are only written to
+ * the database file by #save() (and by the destructor).
+ *
+ * For backward compatibility, the filepath may also point to an INI file (*.ini) as used
+ * by earlier versions. In that case, the database is stored next to the INI file with
+ * the suffix "sqlite" instead, and the content of the INI file is imported when the
+ * database is created.
+ *
+ * All lookup methods are thread safe. To convert several Eagle libraries concurrently,
+ * create one database per library file with #ConverterDb(const ConverterDb&,
+ * const FilePath&), which all share the same UUID storage. Opening and saving the
+ * database must be done in the same thread though (a limitation of QtSql).
  */
 class ConverterDb final
 {
@@ -50,7 +69,8 @@ class ConverterDb final
         // Constructors / Destructor
         ConverterDb() = delete;
         ConverterDb(const ConverterDb& other) = delete;
-        ConverterDb(const FilePath& ini) noexcept;
+        explicit ConverterDb(const FilePath& filepath);
+        ConverterDb(const ConverterDb& other, const FilePath& libFilePath) noexcept;
         ~ConverterDb() noexcept;
 
         // General Methods
@@ -67,17 +87,41 @@ class ConverterDb final
         Uuid getSymbolVariantUuid(const Uuid& componentUuid);
         Uuid getSymbolVariantItemUuid(const Uuid& componentUuid, const QString& gateName);
         Uuid getDeviceUuid(const QString& deviceSetName, const QString& deviceName);
+        QSet<QString> getLibraryFilenames() const noexcept;
+
+        /**
+         * @brief Write all new UUIDs to the database file
+         *
+         * @note Must be called in the thread which opened the database, and only on the
+         *       database created with #ConverterDb(const FilePath&).
+         *
+         * @throw Exception     On error
+         */
+        void save();
 
 
         // Operator Overloadings
         ConverterDb& operator=(const ConverterDb& rhs) = delete;
 
 
-    private:
+    private: // Types
+        struct Storage {
+            QMutex mutex;
+            QHash<QString, Uuid> uuids; ///< key: "category/key", see #getOrCreateUuid()
+            QList<QString> newKeys;     ///< keys of #uuids not yet written to the file
+        };
+
+
+    private: // Methods
         Uuid getOrCreateUuid(const QString& cat, const QString& key1,
                              const QString& key2 = QString());
+        void importIniFile(const FilePath& ini);
+        static QString escapeKey(const QString& key) noexcept;
+
 
-        QSettings mIniFile;
+    private: // Data
+        std::unique_ptr<SQLiteDatabase> mDatabase; ///< only set in the main database
+        QSharedPointer<Storage> mStorage; ///< shared with all per-library databases
         FilePath mLibFilePath;
 };
 
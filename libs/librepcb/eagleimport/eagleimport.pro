@@ -24,14 +24,18 @@ SOURCES += \
     converterdb.cpp \
     deviceconverter.cpp \
     devicesetconverter.cpp \
+    eaglelibraryconverter.cpp \
     packageconverter.cpp \
+    polygonsimplifier.cpp \
     symbolconverter.cpp \
 
 HEADERS += \
     converterdb.h \
     deviceconverter.h \
     devicesetconverter.h \
+    eaglelibraryconverter.h \
     packageconverter.h \
+    polygonsimplifier.h \
     symbolconverter.h \
 
 FORMS += \
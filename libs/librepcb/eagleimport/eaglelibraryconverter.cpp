@@ -0,0 +1,252 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "eaglelibraryconverter.h"
+#include "converterdb.h"
+#include "symbolconverter.h"
+#include "packageconverter.h"
+#include "devicesetconverter.h"
+#include "deviceconverter.h"
+#include "polygonsimplifier.h"
+#include <parseagle/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/cmp/component.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+
+using namespace library;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+EagleLibraryConverter::EagleLibraryConverter(ConverterDb& db, const FilePath& outputDir) noexcept :
+    mDb(db), mOutputDir(outputDir)
+{
+}
+
+EagleLibraryConverter::~EagleLibraryConverter() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+QList<EagleLibraryConverter::FileResult> EagleLibraryConverter::convert(
+        const QList<FilePath>& files, ElementTypes types) const noexcept
+{
+    typedef QSharedPointer<const parseagle::Library> LibraryPtr;
+    typedef QPair<bool, QString> ElementResult; // converted, error message
+
+    // The UUIDs of converted elements are derived from the file name (not the path) of
+    // the library, so files with the same name would overwrite each other's elements.
+    QStringList duplicateErrors;
+    QHash<QString, FilePath> filesByName;
+    foreach (const FilePath& fp, files) {
+        if (filesByName.contains(fp.getFilename())) {
+            duplicateErrors.append(QString(tr("Skipped because the file name is not unique, "
+                "the elements would collide with those of \"%1\"."))
+                .arg(filesByName.value(fp.getFilename()).toNative()));
+        } else {
+            filesByName.insert(fp.getFilename(), fp);
+            duplicateErrors.append(QString());
+        }
+    }
+
+    // parse all files concurrently
+    QList<QFuture<QPair<LibraryPtr, QString>>> parseJobs;
+    foreach (const FilePath& fp, files) {
+        if (!duplicateErrors.at(parseJobs.count()).isEmpty()) {
+            parseJobs.append(QFuture<QPair<LibraryPtr, QString>>()); // not parsed
+            continue;
+        }
+        parseJobs.append(QtConcurrent::run([fp]() -> QPair<LibraryPtr, QString> {
+            if (!fp.isExistingFile()) {
+                return qMakePair(LibraryPtr(), QString(tr("File not found: %1")).arg(fp.toNative()));
+            }
+            try {
+                return qMakePair(LibraryPtr(new parseagle::Library(fp.toStr())), QString());
+            } catch (const std::exception& e) {
+                return qMakePair(LibraryPtr(), QString(e.what()));
+            }
+        }));
+    }
+
+    // convert the elements of each file concurrently, as soon as the file is parsed
+    QList<FileResult> results;
+    QList<QList<QFuture<ElementResult>>> elementJobs;
+    for (int i = 0; i < files.count(); ++i) {
+        if (!duplicateErrors.at(i).isEmpty()) {
+            FileResult result = {files.at(i), 0, 0, QStringList{duplicateErrors.at(i)}};
+            results.append(result);
+            elementJobs.append(QList<QFuture<ElementResult>>());
+            continue;
+        }
+        QPair<LibraryPtr, QString> parsed = parseJobs[i].result();
+        parseJobs[i] = QFuture<QPair<LibraryPtr, QString>>(); // release memory early
+        FileResult result = {files.at(i), 0, 0, QStringList()};
+        QList<QFuture<ElementResult>> jobs;
+        if (LibraryPtr library = parsed.first) {
+            // all elements of the same file share their own view of the database
+            QSharedPointer<ConverterDb> db(new ConverterDb(mDb, files.at(i)));
+            const FilePath outputDir = mOutputDir;
+            if (types & Symbols) {
+                foreach (const parseagle::Symbol& symbol, library->getSymbols()) {
+                    const parseagle::Symbol* s = &symbol; // kept alive by "library"
+                    jobs.append(QtConcurrent::run([library, db, outputDir, s]() {
+                        try {
+                            convertSymbol(*s, *db, outputDir); // can throw
+                            return ElementResult(true, QString());
+                        } catch (const std::exception& e) {
+                            return ElementResult(false, QString("%1: %2").arg(s->getName(), e.what()));
+                        }
+                    }));
+                }
+            }
+            if (types & Packages) {
+                foreach (const parseagle::Package& package, library->getPackages()) {
+                    const parseagle::Package* p = &package; // kept alive by "library"
+                    jobs.append(QtConcurrent::run([library, db, outputDir, p]() {
+                        try {
+                            convertPackage(*p, *db, outputDir); // can throw
+                            return ElementResult(true, QString());
+                        } catch (const std::exception& e) {
+                            return ElementResult(false, QString("%1: %2").arg(p->getName(), e.what()));
+                        }
+                    }));
+                }
+            }
+            if (types & Components) {
+                foreach (const parseagle::DeviceSet& deviceSet, library->getDeviceSets()) {
+                    const parseagle::DeviceSet* d = &deviceSet; // kept alive by "library"
+                    jobs.append(QtConcurrent::run([library, db, outputDir, d]() {
+                        try {
+                            bool converted = convertDeviceSet(*d, *db, outputDir); // can throw
+                            return ElementResult(converted, QString());
+                        } catch (const std::exception& e) {
+                            return ElementResult(false, QString("%1: %2").arg(d->getName(), e.what()));
+                        }
+                    }));
+                }
+            }
+            result.elementCount = jobs.count();
+        } else {
+            result.errors.append(parsed.second);
+        }
+        results.append(result);
+        elementJobs.append(jobs);
+    }
+
+    // collect the results
+    for (int i = 0; i < results.count(); ++i) {
+        foreach (const QFuture<ElementResult>& job, elementJobs.at(i)) {
+            ElementResult r = job.result(); // blocks until the element is written
+            if (r.first) {
+                results[i].convertedCount++;
+            }
+            if (!r.second.isEmpty()) {
+                results[i].errors.append(r.second);
+            }
+        }
+    }
+    return results;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+void EagleLibraryConverter::convertSymbol(const parseagle::Symbol& symbol, ConverterDb& db,
+                                          const FilePath& outputDir)
+{
+    // create symbol
+    SymbolConverter converter(symbol, db);
+    std::unique_ptr<Symbol> newSymbol = converter.generate(); // can throw
+
+    // convert line rects to polygon rects
+    PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
+    polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+    // save symbol to file
+    newSymbol->saveIntoParentDirectory(outputDir.getPathTo("sym")); // can throw
+}
+
+void EagleLibraryConverter::convertPackage(const parseagle::Package& package, ConverterDb& db,
+                                           const FilePath& outputDir)
+{
+    // create package
+    PackageConverter converter(package, db);
+    std::unique_ptr<Package> newPackage = converter.generate(); // can throw
+
+    // convert line rects to polygon rects
+    Q_ASSERT(newPackage->getFootprints().count() == 1);
+    PolygonSimplifier<Footprint> polygonSimplifier(*newPackage->getFootprints().first());
+    polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+    // save package to file
+    newPackage->saveIntoParentDirectory(outputDir.getPathTo("pkg")); // can throw
+}
+
+bool EagleLibraryConverter::convertDeviceSet(const parseagle::DeviceSet& deviceSet,
+                                             ConverterDb& db, const FilePath& outputDir)
+{
+    // abort if device name ends with "-US" or "-US_"
+    if (deviceSet.getName().endsWith("-US")) return false;
+    if (deviceSet.getName().endsWith("-US_")) return false;
+
+    // create component
+    DeviceSetConverter converter(deviceSet, db);
+    std::unique_ptr<Component> newComponent = converter.generate(); // can throw
+
+    // create devices
+    foreach (const parseagle::Device& device, deviceSet.getDevices()) {
+        if (device.getPackage().isNull()) continue;
+
+        DeviceConverter devConverter(deviceSet, device, db);
+        std::unique_ptr<Device> newDevice = devConverter.generate(); // can throw
+
+        // save device
+        newDevice->saveIntoParentDirectory(outputDir.getPathTo("dev")); // can throw
+    }
+
+    // save component to file
+    newComponent->saveIntoParentDirectory(outputDir.getPathTo("cmp")); // can throw
+    return true;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace eagleimport
+} // namespace librepcb
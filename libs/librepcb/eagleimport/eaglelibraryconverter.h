@@ -0,0 +1,129 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_EAGLEIMPORT_EAGLELIBRARYCONVERTER_H
+#define LIBREPCB_EAGLEIMPORT_EAGLELIBRARYCONVERTER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+
+namespace parseagle {
+class Symbol;
+class Package;
+class DeviceSet;
+}
+
+namespace librepcb {
+namespace eagleimport {
+
+class ConverterDb;
+
+/*****************************************************************************************
+ *  Class EagleLibraryConverter
+ ****************************************************************************************/
+
+/**
+ * @brief Converts many Eagle libraries (*.lbr) at once into a LibrePCB library directory
+ *
+ * All Eagle libraries are parsed concurrently and their elements are converted and
+ * written concurrently as well, using the global thread pool. Errors do not abort the
+ * conversion, they are collected per input file instead.
+ *
+ * The static methods convert a single element and are thread safe, so they can also be
+ * used to convert elements one by one.
+ */
+class EagleLibraryConverter final
+{
+        Q_DECLARE_TR_FUNCTIONS(EagleLibraryConverter)
+
+    public:
+
+        // Types
+        enum ElementType {
+            Symbols     = 1<<0, ///< Eagle symbols to LibrePCB symbols
+            Packages    = 1<<1, ///< Eagle packages to LibrePCB packages
+            Components  = 1<<2, ///< Eagle device sets to LibrePCB components and devices
+            All         = Symbols | Packages | Components,
+        };
+        Q_DECLARE_FLAGS(ElementTypes, ElementType)
+
+        struct FileResult {
+            FilePath inputFile;
+            int elementCount;       ///< count of elements found in the file
+            int convertedCount;     ///< count of successfully converted elements
+            QStringList errors;     ///< parse error or errors of single elements
+        };
+
+        // Constructors / Destructor
+        EagleLibraryConverter() = delete;
+        EagleLibraryConverter(const EagleLibraryConverter& other) = delete;
+        EagleLibraryConverter(ConverterDb& db, const FilePath& outputDir) noexcept;
+        ~EagleLibraryConverter() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Convert Eagle libraries (blocks until all elements are written)
+         *
+         * Files with the same file name as a previous file are not converted but
+         * reported as failed, because the element UUIDs depend on the file name.
+         *
+         * @param files     The Eagle library files to convert
+         * @param types     The element types to convert
+         *
+         * @return The results of all files (in the same order as the input files)
+         */
+        QList<FileResult> convert(const QList<FilePath>& files,
+                                  ElementTypes types = All) const noexcept;
+
+        // Operator Overloadings
+        EagleLibraryConverter& operator=(const EagleLibraryConverter& rhs) = delete;
+
+        // Static Methods
+        static void convertSymbol(const parseagle::Symbol& symbol, ConverterDb& db,
+                                  const FilePath& outputDir);
+        static void convertPackage(const parseagle::Package& package, ConverterDb& db,
+                                   const FilePath& outputDir);
+        static bool convertDeviceSet(const parseagle::DeviceSet& deviceSet, ConverterDb& db,
+                                     const FilePath& outputDir);
+
+
+    private: // Data
+        ConverterDb& mDb;
+        FilePath mOutputDir;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace eagleimport
+} // namespace librepcb
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(librepcb::eagleimport::EagleLibraryConverter::ElementTypes)
+
+#endif // LIBREPCB_EAGLEIMPORT_EAGLELIBRARYCONVERTER_H
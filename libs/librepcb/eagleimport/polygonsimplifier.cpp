@@ -30,6 +30,7 @@
  *  Namespace
  ****************************************************************************************/
 namespace librepcb {
+namespace eagleimport {
 
 /*****************************************************************************************
  *  Constructors / Destructor
@@ -175,4 +176,5 @@ template class PolygonSimplifier<library::Footprint>;
  *  End of File
  ****************************************************************************************/
 
+} // namespace eagleimport
 } // namespace librepcb
@@ -17,8 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef POLYGONSIMPLIFIER_H
-#define POLYGONSIMPLIFIER_H
+#ifndef LIBREPCB_EAGLEIMPORT_POLYGONSIMPLIFIER_H
+#define LIBREPCB_EAGLEIMPORT_POLYGONSIMPLIFIER_H
 
 /*****************************************************************************************
  *  Includes
@@ -31,6 +31,7 @@
  *  Namespace
  ****************************************************************************************/
 namespace librepcb {
+namespace eagleimport {
 
 /*****************************************************************************************
  *  Class PolygonSimplifier
@@ -70,6 +71,7 @@ class PolygonSimplifier
  *  End of File
  ****************************************************************************************/
 
+} // namespace eagleimport
 } // namespace librepcb
 
-#endif // POLYGONSIMPLIFIER_H
+#endif // LIBREPCB_EAGLEIMPORT_POLYGONSIMPLIFIER_H
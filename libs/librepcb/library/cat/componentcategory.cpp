@@ -43,9 +43,14 @@ ComponentCategory::ComponentCategory(const Uuid& uuid, const Version& version,
 }
 
 ComponentCategory::ComponentCategory(const FilePath& elementDirectory, bool readOnly) :
-    LibraryCategory(elementDirectory, getShortElementName(), getLongElementName(), readOnly)
+    ComponentCategory(elementDirectory, readOnly, parseElementFile(elementDirectory,
+        getShortElementName(), getLongElementName())) // can throw
+{
+}
+
+ComponentCategory::ComponentCategory(const FilePath& elementDirectory, bool readOnly, const SExpression& root) :
+    LibraryCategory(elementDirectory, getShortElementName(), getLongElementName(), readOnly, root)
 {
-    cleanupAfterLoadingElementFromFile();
 }
 
 ComponentCategory::~ComponentCategory() noexcept
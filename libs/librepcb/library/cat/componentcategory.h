@@ -60,6 +60,10 @@ class ComponentCategory final : public LibraryCategory
         // Static Methods
         static QString getShortElementName() noexcept {return QStringLiteral("cmpcat");}
         static QString getLongElementName() noexcept {return QStringLiteral("component_category");}
+
+
+    private: // Methods
+        ComponentCategory(const FilePath& elementDirectory, bool readOnly, const SExpression& root);
 };
 
 /*****************************************************************************************
@@ -47,9 +47,10 @@ LibraryCategory::LibraryCategory(const QString& shortElementName,
 
 LibraryCategory::LibraryCategory(const FilePath& elementDirectory,
                                  const QString& shortElementName,
-                                 const QString& longElementName, bool readOnly) :
-    LibraryBaseElement(elementDirectory, true, shortElementName, longElementName, readOnly),
-    mParentUuid(mLoadingFileDocument.getValueByPath<tl::optional<Uuid>>("parent"))
+                                 const QString& longElementName, bool readOnly,
+                                 const SExpression& root) :
+    LibraryBaseElement(elementDirectory, true, shortElementName, longElementName, readOnly, root),
+    mParentUuid(root.getValueByPath<tl::optional<Uuid>>("parent"))
 {
 }
 
@@ -54,7 +54,8 @@ class LibraryCategory : public LibraryBaseElement
                         const ElementName& name_en_US, const QString& description_en_US,
                         const QString& keywords_en_US );
         LibraryCategory(const FilePath& elementDirectory, const QString& shortElementName,
-                        const QString& longElementName, bool readOnly);
+                        const QString& longElementName, bool readOnly,
+                        const SExpression& root);
         virtual ~LibraryCategory() noexcept;
 
         // Getters: Attributes
@@ -43,9 +43,14 @@ PackageCategory::PackageCategory(const Uuid& uuid, const Version& version,
 }
 
 PackageCategory::PackageCategory(const FilePath& elementDirectory, bool readOnly) :
-    LibraryCategory(elementDirectory, getShortElementName(), getLongElementName(), readOnly)
+    PackageCategory(elementDirectory, readOnly, parseElementFile(elementDirectory,
+        getShortElementName(), getLongElementName())) // can throw
+{
+}
+
+PackageCategory::PackageCategory(const FilePath& elementDirectory, bool readOnly, const SExpression& root) :
+    LibraryCategory(elementDirectory, getShortElementName(), getLongElementName(), readOnly, root)
 {
-    cleanupAfterLoadingElementFromFile();
 }
 
 PackageCategory::~PackageCategory() noexcept
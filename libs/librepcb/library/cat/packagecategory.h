@@ -60,6 +60,10 @@ class PackageCategory final : public LibraryCategory
         // Static Methods
         static QString getShortElementName() noexcept {return QStringLiteral("pkgcat");}
         static QString getLongElementName() noexcept {return QStringLiteral("package_category");}
+
+
+    private: // Methods
+        PackageCategory(const FilePath& elementDirectory, bool readOnly, const SExpression& root);
 };
 
 /*****************************************************************************************
@@ -44,22 +44,26 @@ Component::Component(const Uuid& uuid, const Version& version, const QString& au
 }
 
 Component::Component(const FilePath& elementDirectory, bool readOnly) :
-    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly),
+    Component(elementDirectory, readOnly, parseElementFile(elementDirectory,
+        getShortElementName(), getLongElementName())) // can throw
+{
+}
+
+Component::Component(const FilePath& elementDirectory, bool readOnly, const SExpression& root) :
+    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly, root),
     mSchematicOnly(false), mDefaultValue(), mPrefixes(ComponentPrefix(""))
 {
     // Load all properties
-    mSchematicOnly = mLoadingFileDocument.getValueByPath<bool>("schematic_only");
-    mAttributes.loadFromDomElement(mLoadingFileDocument); // can throw
-    mDefaultValue = mLoadingFileDocument.getValueByPath<QString>("default_value");
-    mPrefixes = NormDependentPrefixMap(mLoadingFileDocument);
-    mSignals.loadFromDomElement(mLoadingFileDocument);
-    mSymbolVariants.loadFromDomElement(mLoadingFileDocument);
+    mSchematicOnly = root.getValueByPath<bool>("schematic_only");
+    mAttributes.loadFromDomElement(root); // can throw
+    mDefaultValue = root.getValueByPath<QString>("default_value");
+    mPrefixes = NormDependentPrefixMap(root);
+    mSignals.loadFromDomElement(root);
+    mSymbolVariants.loadFromDomElement(root);
 
     // backward compatibility - remove this some time!
     mDefaultValue.replace(QRegularExpression("#([_A-Za-z][_\\|0-9A-Za-z]*)"), "{{\\1}}");
     mDefaultValue.replace(QRegularExpression("\\{\\{(\\w+)\\|(\\w+)\\}\\}"), "{{ \\1 or \\2 }}");
-
-    cleanupAfterLoadingElementFromFile();
 }
 
 Component::~Component() noexcept
@@ -125,6 +125,7 @@ class Component final : public LibraryElement
 
 
     private: // Methods
+        Component(const FilePath& elementDirectory, bool readOnly, const SExpression& root);
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -44,13 +44,18 @@ Device::Device(const Uuid& uuid, const Version& version, const QString& author,
 }
 
 Device::Device(const FilePath& elementDirectory, bool readOnly) :
-    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly),
-    mComponentUuid(mLoadingFileDocument.getValueByPath<Uuid>("component")),
-    mPackageUuid(mLoadingFileDocument.getValueByPath<Uuid>("package")),
-    mAttributes(mLoadingFileDocument),
-    mPadSignalMap(mLoadingFileDocument)
+    Device(elementDirectory, readOnly, parseElementFile(elementDirectory,
+        getShortElementName(), getLongElementName())) // can throw
+{
+}
+
+Device::Device(const FilePath& elementDirectory, bool readOnly, const SExpression& root) :
+    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly, root),
+    mComponentUuid(root.getValueByPath<Uuid>("component")),
+    mPackageUuid(root.getValueByPath<Uuid>("package")),
+    mAttributes(root),
+    mPadSignalMap(root)
 {
-    cleanupAfterLoadingElementFromFile();
 }
 
 Device::~Device() noexcept
@@ -88,6 +88,7 @@ class Device final : public LibraryElement
 
 
     private: // Methods
+        Device(const FilePath& elementDirectory, bool readOnly, const SExpression& root);
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
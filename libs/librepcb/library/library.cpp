@@ -52,7 +52,14 @@ Library::Library(const Uuid& uuid, const Version& version, const QString& author
 }
 
 Library::Library(const FilePath& libDir, bool readOnly) :
-    LibraryBaseElement(libDir, false, "lib", "library", readOnly)
+    Library(libDir, readOnly, parseElementFile(libDir, getShortElementName(),
+                                               getLongElementName())) // can throw
+{
+}
+
+Library::Library(const FilePath& libDir, bool readOnly, const SExpression& root) :
+    LibraryBaseElement(libDir, false, getShortElementName(), getLongElementName(), readOnly,
+                       root)
 {
     // check directory suffix
     if (libDir.getSuffix() != "lplib") {
@@ -63,13 +70,13 @@ Library::Library(const FilePath& libDir, bool readOnly) :
 
     // read properties
     try {
-        mUrl = mLoadingFileDocument.getValueByPath<QUrl>("url");
+        mUrl = root.getValueByPath<QUrl>("url");
     } catch (const Exception& e) {
         qWarning() << e.getMsg();
     }
 
     // read dependency UUIDs
-    foreach (const SExpression& node, mLoadingFileDocument.getChildren("dependency")) {
+    foreach (const SExpression& node, root.getChildren("dependency")) {
         mDependencies.insert(node.getValueOfFirstChild<Uuid>());
     }
 
@@ -77,8 +84,6 @@ Library::Library(const FilePath& libDir, bool readOnly) :
     if (getIconFilePath().isExistingFile()) {
         mIcon = QPixmap(getIconFilePath().toStr());
     }
-
-    cleanupAfterLoadingElementFromFile();
 }
 
 Library::~Library() noexcept
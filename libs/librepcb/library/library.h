@@ -87,6 +87,7 @@ class Library final : public LibraryBaseElement
 
 
     private: // Methods
+        Library(const FilePath& libDir, bool readOnly, const SExpression& root);
 
         // Private Methods
         virtual void copyTo(const FilePath& destination, bool removeSource) override;
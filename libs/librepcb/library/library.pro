@@ -38,6 +38,8 @@ SOURCES += \
     library.cpp \
     librarybaseelement.cpp \
     libraryelement.cpp \
+    libraryelementmetadata.cpp \
+    libraryupgrader.cpp \
     pkg/cmd/cmdfootprintedit.cpp \
     pkg/cmd/cmdfootprintpadedit.cpp \
     pkg/cmd/cmdpackagepadedit.cpp \
@@ -79,6 +81,8 @@ HEADERS += \
     library.h \
     librarybaseelement.h \
     libraryelement.h \
+    libraryelementmetadata.h \
+    libraryupgrader.h \
     pkg/cmd/cmdfootprintedit.h \
     pkg/cmd/cmdfootprintpadedit.h \
     pkg/cmd/cmdpackagepadedit.h \
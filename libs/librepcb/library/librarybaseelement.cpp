@@ -60,7 +60,8 @@ LibraryBaseElement::LibraryBaseElement(bool dirnameMustBeUuid, const QString& sh
 LibraryBaseElement::LibraryBaseElement(const FilePath& elementDirectory,
                                        bool dirnameMustBeUuid,
                                        const QString& shortElementName,
-                                       const QString& longElementName, bool readOnly) :
+                                       const QString& longElementName, bool readOnly,
+                                       const SExpression& root) :
     QObject(nullptr), mDirectory(elementDirectory),mDirectoryIsTemporary(false),
     mOpenedReadOnly(readOnly), mDirectoryNameMustBeUuid(dirnameMustBeUuid),
     mShortElementName(shortElementName), mLongElementName(longElementName),
@@ -70,16 +71,6 @@ LibraryBaseElement::LibraryBaseElement(const FilePath& elementDirectory,
     mDescriptions(""),
     mKeywords("")
 {
-    // determine the filepath to the version file
-    FilePath versionFilePath = mDirectory.getPathTo(".librepcb-" % mShortElementName);
-
-    // check if the directory is a library element
-    if (!versionFilePath.isExistingFile()) {
-        throw RuntimeError(__FILE__, __LINE__,
-            QString(tr("Directory is not a library element of type %1: \"%2\""))
-            .arg(mLongElementName, mDirectory.toNative()));
-    }
-
     // check directory name
     QString dirUuidStr = mDirectory.getFilename();
     if (mDirectoryNameMustBeUuid && (!Uuid::isValid(dirUuidStr))) {
@@ -88,43 +79,29 @@ LibraryBaseElement::LibraryBaseElement(const FilePath& elementDirectory,
             .arg(mDirectory.toNative()));
     }
 
-    // read version number from version file
-    SmartVersionFile versionFile(versionFilePath, false, true);
-    if (versionFile.getVersion() > qApp->getAppVersion()) {
-        throw RuntimeError(__FILE__, __LINE__,
-            QString(tr("The library element %1 was created with a newer application "
-                       "version. You need at least LibrePCB version %2 to open it."))
-            .arg(mDirectory.toNative()).arg(versionFile.getVersion().toPrettyStr(3)));
-    }
-
-    // open main file
-    FilePath sexprFilePath = mDirectory.getPathTo(mLongElementName % ".lp");
-    SmartSExprFile sexprFile(sexprFilePath, false, true);
-    mLoadingFileDocument = sexprFile.parseFileAndBuildDomTree();
-
     // read attributes
-    if (mLoadingFileDocument.getChildByIndex(0).isString()) {
-        mUuid = mLoadingFileDocument.getChildByIndex(0).getValue<Uuid>();
+    if (root.getChildByIndex(0).isString()) {
+        mUuid = root.getChildByIndex(0).getValue<Uuid>();
     } else {
         // backward compatibility, remove this some time!
-        mUuid = mLoadingFileDocument.getValueByPath<Uuid>("uuid");
+        mUuid = root.getValueByPath<Uuid>("uuid");
     }
-    mVersion = mLoadingFileDocument.getValueByPath<Version>("version");
-    mAuthor = mLoadingFileDocument.getValueByPath<QString>("author");
-    mCreated = mLoadingFileDocument.getValueByPath<QDateTime>("created");
-    mIsDeprecated = mLoadingFileDocument.getValueByPath<bool>("deprecated");
+    mVersion = root.getValueByPath<Version>("version");
+    mAuthor = root.getValueByPath<QString>("author");
+    mCreated = root.getValueByPath<QDateTime>("created");
+    mIsDeprecated = root.getValueByPath<bool>("deprecated");
 
     // read names, descriptions and keywords in all available languages
-    mNames = LocalizedNameMap(mLoadingFileDocument);
-    mDescriptions = LocalizedDescriptionMap(mLoadingFileDocument);
-    mKeywords = LocalizedKeywordsMap(mLoadingFileDocument);
+    mNames = LocalizedNameMap(root);
+    mDescriptions = LocalizedDescriptionMap(root);
+    mKeywords = LocalizedKeywordsMap(root);
 
     // check if the UUID equals to the directory basename
     if (mDirectoryNameMustBeUuid && (mUuid.toStr() != dirUuidStr)) {
         qDebug() << mUuid.toStr() << "!=" << dirUuidStr;
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("UUID mismatch between element directory and main file: \"%1\""))
-            .arg(sexprFilePath.toNative()));
+            .arg(mDirectory.getPathTo(mLongElementName % ".lp").toNative()));
     }
 }
 
@@ -205,9 +182,33 @@ void LibraryBaseElement::moveIntoParentDirectory(const FilePath& parentDir)
  *  Protected Methods
  ****************************************************************************************/
 
-void LibraryBaseElement::cleanupAfterLoadingElementFromFile() noexcept
+SExpression LibraryBaseElement::parseElementFile(const FilePath& elementDirectory,
+                                                 const QString& shortElementName,
+                                                 const QString& longElementName)
 {
-    mLoadingFileDocument = SExpression(); // destroy the whole DOM tree
+    // determine the filepath to the version file
+    FilePath versionFilePath = elementDirectory.getPathTo(".librepcb-" % shortElementName);
+
+    // check if the directory is a library element
+    if (!versionFilePath.isExistingFile()) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Directory is not a library element of type %1: \"%2\""))
+            .arg(longElementName, elementDirectory.toNative()));
+    }
+
+    // read version number from version file
+    SmartVersionFile versionFile(versionFilePath, false, true);
+    if (versionFile.getVersion() > qApp->getAppVersion()) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("The library element %1 was created with a newer application "
+                       "version. You need at least LibrePCB version %2 to open it."))
+            .arg(elementDirectory.toNative()).arg(versionFile.getVersion().toPrettyStr(3)));
+    }
+
+    // open main file
+    FilePath sexprFilePath = elementDirectory.getPathTo(longElementName % ".lp");
+    SmartSExprFile sexprFile(sexprFilePath, false, true);
+    return sexprFile.parseFileAndBuildDomTree(); // can throw
 }
 
 void LibraryBaseElement::copyTo(const FilePath& destination, bool removeSource)
@@ -61,7 +61,7 @@ class LibraryBaseElement : public QObject, public SerializableObject
                            const QString& keywords_en_US);
         LibraryBaseElement(const FilePath& elementDirectory, bool dirnameMustBeUuid,
                            const QString& shortElementName, const QString& longElementName,
-                           bool readOnly);
+                           bool readOnly, const SExpression& root);
         virtual ~LibraryBaseElement() noexcept;
 
         // Getters: General
@@ -106,12 +106,30 @@ class LibraryBaseElement : public QObject, public SerializableObject
     protected:
 
         // Protected Methods
-        virtual void cleanupAfterLoadingElementFromFile() noexcept;
         virtual void copyTo(const FilePath& destination, bool removeSource);
 
         /// @copydoc librepcb::SerializableObject::serialize()
         virtual void serialize(SExpression& root) const override;
 
+        /**
+         * @brief Check the version of a library element directory and parse its main file
+         *
+         * Subclasses pass the returned DOM tree through their constructors, so it is
+         * released as soon as the element is constructed.
+         *
+         * @param elementDirectory  The directory of the element to load
+         * @param shortElementName  The short element name, e.g. "sym"
+         * @param longElementName   The long element name, e.g. "symbol"
+         *
+         * @return The DOM tree of the main file
+         *
+         * @throws Exception if the directory is not a valid library element, if it was
+         *         created with a newer application version or if the file is invalid
+         */
+        static SExpression parseElementFile(const FilePath& elementDirectory,
+                                            const QString& shortElementName,
+                                            const QString& longElementName);
+
 
         // General Attributes
         mutable FilePath mDirectory;
@@ -121,9 +139,6 @@ class LibraryBaseElement : public QObject, public SerializableObject
         QString mShortElementName; ///< e.g. "lib", "cmpcat", "sym"
         QString mLongElementName; ///< e.g. "library", "component_category", "symbol"
 
-        // Members required for loading elements from file
-        SExpression mLoadingFileDocument;
-
         // General Library Element Attributes
         Uuid mUuid;
         Version mVersion;
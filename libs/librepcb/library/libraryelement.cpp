@@ -47,11 +47,12 @@ LibraryElement::LibraryElement(const QString& shortElementName,
 }
 
 LibraryElement::LibraryElement(const FilePath& elementDirectory, const QString& shortElementName,
-                               const QString& longElementName, bool readOnly) :
-    LibraryBaseElement(elementDirectory, true, shortElementName, longElementName, readOnly)
+                               const QString& longElementName, bool readOnly,
+                               const SExpression& root) :
+    LibraryBaseElement(elementDirectory, true, shortElementName, longElementName, readOnly, root)
 {
     // read category UUIDs
-    foreach (const SExpression& node, mLoadingFileDocument.getChildren("category")) {
+    foreach (const SExpression& node, root.getChildren("category")) {
         mCategories.insert(node.getValueOfFirstChild<Uuid>());
     }
 }
@@ -0,0 +1,172 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "libraryelementmetadata.h"
+#include "dev/device.h"
+#include <librepcb/common/fileio/smartversionfile.h>
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/application.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+LibraryElementMetadata::LibraryElementMetadata(const FilePath& elementDirectory,
+                                               bool dirnameMustBeUuid,
+                                               const QString& shortElementName,
+                                               const QString& longElementName) :
+    mDirectory(elementDirectory),
+    mUuid(Uuid::createRandom()), // just for initialization, will be overwritten
+    mVersion(Version::fromString("0.1")), // just for initialization, will be overwritten
+    mIsDeprecated(false),
+    mNames(ElementName("unknown")), // just for initialization, will be overwritten
+    mDescriptions(""),
+    mKeywords("")
+{
+    // check if the directory is a library element
+    FilePath versionFilePath = mDirectory.getPathTo(".librepcb-" % shortElementName);
+    if (!versionFilePath.isExistingFile()) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Directory is not a library element of type %1: \"%2\""))
+            .arg(longElementName, mDirectory.toNative()));
+    }
+
+    // check directory name
+    QString dirUuidStr = mDirectory.getFilename();
+    if (dirnameMustBeUuid && (!Uuid::isValid(dirUuidStr))) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Directory name is not a valid UUID: \"%1\""))
+            .arg(mDirectory.toNative()));
+    }
+
+    // read version number from version file
+    SmartVersionFile versionFile(versionFilePath, false, true);
+    if (versionFile.getVersion() > qApp->getAppVersion()) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("The library element %1 was created with a newer application "
+                       "version. You need at least LibrePCB version %2 to open it."))
+            .arg(mDirectory.toNative()).arg(versionFile.getVersion().toPrettyStr(3)));
+    }
+
+    // Parse only the header of the main file. The header nodes are always written
+    // before all other nodes, but if a (manually modified) file contains them in
+    // another order, fall back to parsing the whole file.
+    static const QSet<QString> headerNodes = {"uuid", "name", "description", "keywords",
+        "author", "version", "created", "deprecated", "category", "parent", "component",
+        "package"};
+    FilePath sexprFilePath = mDirectory.getPathTo(longElementName % ".lp");
+    QString content = FileUtils::readFile(sexprFilePath); // can throw
+    try {
+        load(SExpression::parseHeader(content, sexprFilePath, headerNodes),
+             longElementName); // can throw
+    } catch (const Exception& e) {
+        load(SExpression::parse(content, sexprFilePath), longElementName); // can throw
+    }
+
+    // check if the UUID equals to the directory basename
+    if (dirnameMustBeUuid && (mUuid.toStr() != dirUuidStr)) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("UUID mismatch between element directory and main file: \"%1\""))
+            .arg(sexprFilePath.toNative()));
+    }
+}
+
+LibraryElementMetadata::~LibraryElementMetadata() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QStringList LibraryElementMetadata::getAllAvailableLocales() const noexcept
+{
+    QStringList list;
+    list.append(mNames.keys());
+    list.append(mDescriptions.keys());
+    list.append(mKeywords.keys());
+    list.removeDuplicates();
+    list.sort(Qt::CaseSensitive);
+    return list;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void LibraryElementMetadata::load(const SExpression& root, const QString& longElementName)
+{
+    // same as in LibraryBaseElement
+    if (root.getChildByIndex(0).isString()) {
+        mUuid = root.getChildByIndex(0).getValue<Uuid>();
+    } else {
+        // backward compatibility, remove this some time!
+        mUuid = root.getValueByPath<Uuid>("uuid");
+    }
+    mVersion = root.getValueByPath<Version>("version");
+    mAuthor = root.getValueByPath<QString>("author");
+    mIsDeprecated = root.getValueByPath<bool>("deprecated");
+    mNames = LocalizedNameMap(root);
+    mDescriptions = LocalizedDescriptionMap(root);
+    mKeywords = LocalizedKeywordsMap(root);
+
+    // same as in LibraryElement
+    mCategories.clear();
+    foreach (const SExpression& node, root.getChildren("category")) {
+        mCategories.insert(node.getValueOfFirstChild<Uuid>());
+    }
+
+    // same as in LibraryCategory and Device
+    mParentUuid = tl::nullopt;
+    mComponentUuid = tl::nullopt;
+    mPackageUuid = tl::nullopt;
+    if (root.tryGetChildByPath("parent")) {
+        mParentUuid = root.getValueByPath<tl::optional<Uuid>>("parent");
+    }
+    if (root.tryGetChildByPath("component")) {
+        mComponentUuid = root.getValueByPath<Uuid>("component");
+    }
+    if (root.tryGetChildByPath("package")) {
+        mPackageUuid = root.getValueByPath<Uuid>("package");
+    }
+    if (longElementName == Device::getLongElementName()) {
+        if ((!mComponentUuid) || (!mPackageUuid)) {
+            throw RuntimeError(__FILE__, __LINE__, QString(tr("The device %1 does "
+                "not specify a component or package.")).arg(mDirectory.toNative()));
+        }
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
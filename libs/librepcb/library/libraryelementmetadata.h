@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+#define LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/uuid.h>
+#include <librepcb/common/version.h>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/fileio/serializablekeyvaluemap.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class SExpression;
+
+namespace library {
+
+/*****************************************************************************************
+ *  Class LibraryElementMetadata
+ ****************************************************************************************/
+
+/**
+ * @brief The LibraryElementMetadata class reads only the metadata of a library element
+ *
+ * In contrast to constructing a complete #LibraryBaseElement subclass object (which
+ * deserializes all geometry, pins, signals etc.), only the header nodes at the beginning
+ * of the element's main file are parsed (see librepcb::SExpression::parseHeader()). This
+ * makes it several times faster to get the metadata required e.g. to index the
+ * libraries in the workspace library database.
+ *
+ * The same checks as when opening the element normally are performed (element type,
+ * directory name, file format version). Attributes which are not available for the
+ * element type are left empty (e.g. #getParentUuid() for non-categories).
+ */
+class LibraryElementMetadata final
+{
+        Q_DECLARE_TR_FUNCTIONS(LibraryElementMetadata)
+
+    public:
+
+        // Constructors / Destructor
+        LibraryElementMetadata() = delete;
+        LibraryElementMetadata(const LibraryElementMetadata& other) = default;
+        LibraryElementMetadata(const FilePath& elementDirectory, bool dirnameMustBeUuid,
+                               const QString& shortElementName,
+                               const QString& longElementName);
+        ~LibraryElementMetadata() noexcept;
+
+        // Getters: Attributes of all library elements
+        const FilePath& getFilePath() const noexcept {return mDirectory;}
+        const Uuid& getUuid() const noexcept {return mUuid;}
+        const Version& getVersion() const noexcept {return mVersion;}
+        const QString& getAuthor() const noexcept {return mAuthor;}
+        bool isDeprecated() const noexcept {return mIsDeprecated;}
+        const LocalizedNameMap& getNames() const noexcept {return mNames;}
+        const LocalizedDescriptionMap& getDescriptions() const noexcept {return mDescriptions;}
+        const LocalizedKeywordsMap& getKeywords() const noexcept {return mKeywords;}
+        QStringList getAllAvailableLocales() const noexcept;
+
+        // Getters: Element type specific attributes
+        const QSet<Uuid>& getCategories() const noexcept {return mCategories;}
+        const tl::optional<Uuid>& getParentUuid() const noexcept {return mParentUuid;}
+        const tl::optional<Uuid>& getComponentUuid() const noexcept {return mComponentUuid;}
+        const tl::optional<Uuid>& getPackageUuid() const noexcept {return mPackageUuid;}
+
+        // Operator Overloadings
+        LibraryElementMetadata& operator=(const LibraryElementMetadata& rhs) = default;
+
+        // Static Methods
+        template <typename ElementType>
+        static LibraryElementMetadata open(const FilePath& elementDirectory) {
+            return LibraryElementMetadata(elementDirectory, true,
+                                          ElementType::getShortElementName(),
+                                          ElementType::getLongElementName()); // can throw
+        }
+
+
+    private: // Methods
+        void load(const SExpression& root, const QString& longElementName);
+
+
+    private: // Data
+        FilePath mDirectory;
+        Uuid mUuid;
+        Version mVersion;
+        QString mAuthor;
+        bool mIsDeprecated;
+        LocalizedNameMap mNames;
+        LocalizedDescriptionMap mDescriptions;
+        LocalizedKeywordsMap mKeywords;
+        QSet<Uuid> mCategories;
+        tl::optional<Uuid> mParentUuid;
+        tl::optional<Uuid> mComponentUuid;
+        tl::optional<Uuid> mPackageUuid;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
+
+#endif // LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
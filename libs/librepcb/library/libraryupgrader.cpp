@@ -0,0 +1,150 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "libraryupgrader.h"
+#include "elements.h"
+#include <librepcb/common/fileio/filewritebatch.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+LibraryUpgrader::LibraryUpgrader(const FilePath& libDir) noexcept :
+    mLibDir(libDir)
+{
+}
+
+LibraryUpgrader::~LibraryUpgrader() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+LibraryUpgrader::Result LibraryUpgrader::upgrade(bool save) const noexcept
+{
+    Result result = {0, 0, 0, QStringList()};
+    std::unique_ptr<Library> lib;
+    try {
+        lib.reset(new Library(mLibDir, !save)); // can throw
+    } catch (const Exception& e) {
+        result.errors.append(e.getMsg());
+        return result;
+    }
+
+    // open all elements concurrently
+    QList<QFuture<ElementResult>> jobs;
+    upgradeElements<ComponentCategory>(*lib, save, jobs, result);
+    upgradeElements<PackageCategory>(*lib, save, jobs, result);
+    upgradeElements<Symbol>(*lib, save, jobs, result);
+    upgradeElements<Package>(*lib, save, jobs, result);
+    upgradeElements<Component>(*lib, save, jobs, result);
+    upgradeElements<Device>(*lib, save, jobs, result);
+
+    // the library itself is handled in this thread meanwhile
+    result.elementCount++;
+    try {
+        if (save && saveModifiedFiles(*lib)) { // can throw
+            result.modifiedCount++;
+        }
+    } catch (const Exception& e) {
+        result.errors.append(QString("%1: %2").arg(mLibDir.toNative(), e.getMsg()));
+    }
+
+    // collect the results (errors of elements must not abort waiting for the others)
+    foreach (const QFuture<ElementResult>& job, jobs) {
+        try {
+            ElementResult r = job.result(); // blocks until the element is processed
+            if (r.first) {
+                result.modifiedCount++;
+            }
+            if (!r.second.isEmpty()) {
+                result.errors.append(r.second);
+            }
+        } catch (const Exception& e) {
+            result.errors.append(e.getMsg());
+        }
+    }
+    return result;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+template <typename ElementType>
+void LibraryUpgrader::upgradeElements(const Library& lib, bool save,
+                                      QList<QFuture<ElementResult>>& jobs,
+                                      Result& result) const noexcept
+{
+    foreach (const FilePath& fp, lib.searchForElements<ElementType>()) {
+        if (fp.getBasename() == "00000000-0000-4001-8000-000000000000") {
+            // ignore demo files as they contain documentation which would be removed
+            result.ignoredCount++;
+            continue;
+        }
+        result.elementCount++;
+        jobs.append(QtConcurrent::run([fp, save]() {
+            try {
+                ElementType element(fp, !save); // can throw
+                bool modified = save && saveModifiedFiles(element); // can throw
+                return ElementResult(modified, QString());
+            } catch (const Exception& e) {
+                return ElementResult(false, QString("%1: %2").arg(fp.toNative(), e.getMsg()));
+            }
+        }));
+    }
+}
+
+bool LibraryUpgrader::saveModifiedFiles(LibraryBaseElement& element)
+{
+    // record the files instead of writing them, to write only the modified ones
+    FileWriteBatch batch;
+    {
+        FileWriteBatch::Recorder recorder(batch);
+        element.save(); // can throw
+    }
+
+    QStringList errors;
+    int writtenFiles = 0;
+    if (!batch.execute(errors, &writtenFiles)) {
+        throw RuntimeError(__FILE__, __LINE__, errors.join("\n"));
+    }
+    return writtenFiles > 0;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
@@ -0,0 +1,115 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYUPGRADER_H
+#define LIBREPCB_LIBRARY_LIBRARYUPGRADER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+class Library;
+class LibraryBaseElement;
+
+/*****************************************************************************************
+ *  Class LibraryUpgrader
+ ****************************************************************************************/
+
+/**
+ * @brief Opens all elements of a library and optionally saves them again
+ *
+ * This upgrades the library to the current file format and normalizes the files (e.g.
+ * formatting). The elements are processed concurrently using the global thread pool.
+ *
+ * When saving, the files are first recorded into a librepcb::FileWriteBatch and only
+ * those files whose serialized content differs from the file on disk are written. So
+ * running the upgrader on an already upgraded library doesn't modify any file.
+ */
+class LibraryUpgrader final
+{
+        Q_DECLARE_TR_FUNCTIONS(LibraryUpgrader)
+
+    public:
+
+        // Types
+        struct Result {
+            int elementCount;       ///< count of opened elements (incl. the library)
+            int modifiedCount;      ///< count of elements with rewritten files
+            int ignoredCount;       ///< count of skipped elements (demo files)
+            QStringList errors;     ///< errors of single elements
+        };
+
+        // Constructors / Destructor
+        LibraryUpgrader() = delete;
+        LibraryUpgrader(const LibraryUpgrader& other) = delete;
+        explicit LibraryUpgrader(const FilePath& libDir) noexcept;
+        ~LibraryUpgrader() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Open (and optionally save) the library and all its elements
+         *
+         * Blocks until all elements are processed.
+         *
+         * @param save      If true, the elements are saved (only modified files are
+         *                  written). If false, the elements are only opened to check
+         *                  whether they are valid.
+         *
+         * @return The result of the upgrade
+         */
+        Result upgrade(bool save) const noexcept;
+
+        // Operator Overloadings
+        LibraryUpgrader& operator=(const LibraryUpgrader& rhs) = delete;
+
+
+    private: // Types
+        typedef QPair<bool, QString> ElementResult; // modified, error message
+
+
+    private: // Methods
+        template <typename ElementType>
+        void upgradeElements(const Library& lib, bool save,
+                             QList<QFuture<ElementResult>>& jobs,
+                             Result& result) const noexcept;
+        static bool saveModifiedFiles(LibraryBaseElement& element);
+
+
+    private: // Data
+        FilePath mLibDir;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
+
+#endif // LIBREPCB_LIBRARY_LIBRARYUPGRADER_H
@@ -89,12 +89,30 @@ QString FootprintPad::getLayerName() const noexcept
     }
 }
 
+GraphicsLayerId FootprintPad::getLayerId() const noexcept
+{
+    static const GraphicsLayerId topCopper(GraphicsLayer::sTopCopper);
+    static const GraphicsLayerId botCopper(GraphicsLayer::sBotCopper);
+    static const GraphicsLayerId padsTht(GraphicsLayer::sBoardPadsTht);
+    switch (mBoardSide) {
+        case BoardSide::TOP:        return topCopper;
+        case BoardSide::BOTTOM:     return botCopper;
+        case BoardSide::THT:        return padsTht;
+        default: Q_ASSERT(false);   return GraphicsLayerId();
+    }
+}
+
 bool FootprintPad::isOnLayer(const QString& name) const noexcept
+{
+    return isOnLayer(GraphicsLayerId(name));
+}
+
+bool FootprintPad::isOnLayer(const GraphicsLayerId& layer) const noexcept
 {
     if (mBoardSide == BoardSide::THT) {
-        return GraphicsLayer::isCopperLayer(name);
+        return layer.isCopperLayer();
     } else {
-        return (name == getLayerName());
+        return (layer == getLayerId());
     }
 }
 
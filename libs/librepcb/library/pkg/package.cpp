@@ -43,12 +43,16 @@ Package::Package(const Uuid& uuid, const Version& version, const QString& author
 }
 
 Package::Package(const FilePath& elementDirectory, bool readOnly) :
-    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly)
+    Package(elementDirectory, readOnly, parseElementFile(elementDirectory,
+        getShortElementName(), getLongElementName())) // can throw
 {
-    mPads.loadFromDomElement(mLoadingFileDocument);
-    mFootprints.loadFromDomElement(mLoadingFileDocument);
+}
 
-    cleanupAfterLoadingElementFromFile();
+Package::Package(const FilePath& elementDirectory, bool readOnly, const SExpression& root) :
+    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly, root)
+{
+    mPads.loadFromDomElement(root);
+    mFootprints.loadFromDomElement(root);
 }
 
 Package::~Package() noexcept
@@ -82,6 +82,7 @@ class Package final : public LibraryElement
 
 
     private: // Methods
+        Package(const FilePath& elementDirectory, bool readOnly, const SExpression& root);
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
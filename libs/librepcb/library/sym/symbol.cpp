@@ -46,21 +46,25 @@ Symbol::Symbol(const Uuid& uuid, const Version& version, const QString& author,
 }
 
 Symbol::Symbol(const FilePath& elementDirectory, bool readOnly) :
-    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly),
+    Symbol(elementDirectory, readOnly, parseElementFile(elementDirectory,
+        getShortElementName(), getLongElementName())) // can throw
+{
+}
+
+Symbol::Symbol(const FilePath& elementDirectory, bool readOnly, const SExpression& root) :
+    LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly, root),
     mPins(this), mPolygons(this), mCircles(this), mTexts(this),
     mRegisteredGraphicsItem(nullptr)
 {
-    mPins.loadFromDomElement(mLoadingFileDocument); // can throw
-    mPolygons.loadFromDomElement(mLoadingFileDocument); // can throw
-    mCircles.loadFromDomElement(mLoadingFileDocument); // can throw
-    mTexts.loadFromDomElement(mLoadingFileDocument); // can throw
+    mPins.loadFromDomElement(root); // can throw
+    mPolygons.loadFromDomElement(root); // can throw
+    mCircles.loadFromDomElement(root); // can throw
+    mTexts.loadFromDomElement(root); // can throw
 
     // backward compatibility, remove this some time!
-    foreach (const SExpression& child, mLoadingFileDocument.getChildren("ellipse")) {
+    foreach (const SExpression& child, root.getChildren("ellipse")) {
         mCircles.append(std::make_shared<Circle>(child));
     }
-
-    cleanupAfterLoadingElementFromFile();
 }
 
 Symbol::~Symbol() noexcept
@@ -91,6 +91,7 @@ class Symbol final : public LibraryElement, private SymbolPinList::IF_Observer,
 
 
     private: // Methods
+        Symbol(const FilePath& elementDirectory, bool readOnly, const SExpression& root);
         void listObjectAdded(const SymbolPinList& list, int newIndex,
                              const std::shared_ptr<SymbolPin>& ptr) noexcept override;
         void listObjectAdded(const PolygonList& list, int newIndex,
@@ -84,6 +84,8 @@ LibraryOverviewWidget::LibraryOverviewWidget(const Context& context,
     updateElementLists();
     connect(&mContext.workspace.getLibraryDb(), &workspace::WorkspaceLibraryDb::scanSucceeded,
             this, &LibraryOverviewWidget::updateElementLists);
+    connect(&mContext.workspace.getLibraryDb(), &workspace::WorkspaceLibraryDb::elementsChanged,
+            this, &LibraryOverviewWidget::libraryElementsChanged);
 
     connect(mUi->lstCmpCat, &QListWidget::doubleClicked, this,
             &LibraryOverviewWidget::lstCmpCatDoubleClicked);
@@ -144,6 +146,16 @@ void LibraryOverviewWidget::updateIcon() noexcept
     }
 }
 
+void LibraryOverviewWidget::libraryElementsChanged(const QSet<FilePath>& elementDirs) noexcept
+{
+    foreach (const FilePath& dir, elementDirs) {
+        if (dir.isLocatedInDir(mLibrary->getFilePath())) {
+            updateElementLists();
+            return;
+        }
+    }
+}
+
 void LibraryOverviewWidget::updateElementLists() noexcept
 {
     updateElementList<ComponentCategory>(*mUi->lstCmpCat, QIcon(":/img/places/folder.png"));
@@ -87,6 +87,7 @@ class LibraryOverviewWidget final : public EditorWidgetBase
     private: // Methods
         bool isInterfaceBroken() const noexcept override {return false;}
         void updateIcon() noexcept;
+        void libraryElementsChanged(const QSet<FilePath>& elementDirs) noexcept;
         void updateElementLists() noexcept;
         template <typename ElementType>
         void updateElementList(QListWidget& listWidget, const QIcon& icon) noexcept;
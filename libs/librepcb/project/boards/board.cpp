@@ -36,6 +36,7 @@
 #include <librepcb/common/gridproperties.h>
 #include "../circuit/circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../circuit/componentinstance.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
@@ -49,6 +50,7 @@
 #include "items/bi_hole.h"
 #include "items/bi_plane.h"
 #include "items/bi_airwire.h"
+#include "graphicsitems/bgi_netlinebatch.h"
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/pkg/footprint.h>
 #include "items/bi_polygon.h"
@@ -71,7 +73,8 @@ namespace project {
 
 Board::Board(const Board& other, const FilePath& filepath, const ElementName& name) :
     QObject(&other.getProject()), mProject(other.getProject()), mFilePath(filepath),
-    mIsAddedToProject(false), mUuid(Uuid::createRandom()), mName(name),
+    mIsAddedToProject(false), mNetLineBatchingEnabled(false),
+    mUuid(Uuid::createRandom()), mName(name),
     mDefaultFontFileName(other.mDefaultFontFileName)
 {
     try
@@ -150,6 +153,7 @@ Board::Board(const Board& other, const FilePath& filepath, const ElementName& na
     catch (...)
     {
         // free the allocated memory in the reverse order of their allocation...
+        mProject.getErcMsgList().cancelUpdate(*this);
         qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
         qDeleteAll(mAirWires);          mAirWires.clear();
         qDeleteAll(mHoles);             mHoles.clear();
@@ -158,6 +162,7 @@ Board::Board(const Board& other, const FilePath& filepath, const ElementName& na
         qDeleteAll(mPlanes);            mPlanes.clear();
         qDeleteAll(mNetSegments);       mNetSegments.clear();
         qDeleteAll(mDeviceInstances);   mDeviceInstances.clear();
+        qDeleteAll(mNetLineBatches);    mNetLineBatches.clear();
         mUserSettings.reset();
         mFabricationOutputSettings.reset();
         mDesignRules.reset();
@@ -169,20 +174,25 @@ Board::Board(const Board& other, const FilePath& filepath, const ElementName& na
     }
 }
 
-Board::Board(Project& project, const FilePath& filepath, bool restore,
-             bool readOnly, bool create, const QString& newName) :
-    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false),
+Board::Board(Project& project, std::unique_ptr<SmartSExprFile> file,
+             const SExpression& root) :
+    Board(project, std::move(file), &root, QString())
+{
+}
+
+Board::Board(Project& project, std::unique_ptr<SmartSExprFile> file,
+             const SExpression* root, const QString& newName) :
+    QObject(&project), mProject(project), mFilePath(file->getFilepath()),
+    mIsAddedToProject(false), mNetLineBatchingEnabled(false),
     mUuid(Uuid::createRandom()), mName("New Board")
 {
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
+        mFile.reset(file.release());
 
-        // try to open/create the board file
-        if (create)
+        if (!root)
         {
-            mFile.reset(SmartSExprFile::create(mFilePath));
-
             // set attributes
             mName = newName;
             mDefaultFontFileName = qApp->getDefaultStrokeFontName();
@@ -200,7 +210,8 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
             mFabricationOutputSettings.reset(new BoardFabricationOutputSettings());
 
             // load default user settings
-            mUserSettings.reset(new BoardUserSettings(*this, restore, readOnly, create));
+            mUserSettings.reset(new BoardUserSettings(*this, mFile->isRestored(),
+                                                      mFile->isReadOnly(), mFile->isCreated()));
 
             // add 160x100mm board outline (Eurocard size)
             Polygon polygon(Uuid::createRandom(),
@@ -211,35 +222,32 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
         }
         else
         {
-            mFile.reset(new SmartSExprFile(mFilePath, restore, readOnly));
-            SExpression root = mFile->parseFileAndBuildDomTree();
-
             // the board seems to be ready to open, so we will create all needed objects
 
-            if (root.getChildByIndex(0).isString()) {
-                mUuid = root.getChildByIndex(0).getValue<Uuid>();
+            if (root->getChildByIndex(0).isString()) {
+                mUuid = root->getChildByIndex(0).getValue<Uuid>();
             } else {
                 // backward compatibility, remove this some time!
-                mUuid = root.getValueByPath<Uuid>("uuid");
+                mUuid = root->getValueByPath<Uuid>("uuid");
             }
-            mName = root.getValueByPath<ElementName>("name");
-            if (const SExpression* child = root.tryGetChildByPath("default_font")) {
+            mName = root->getValueByPath<ElementName>("name");
+            if (const SExpression* child = root->tryGetChildByPath("default_font")) {
                 mDefaultFontFileName = child->getValueOfFirstChild<QString>(true);
             } else {
                 mDefaultFontFileName = qApp->getDefaultStrokeFontName();
             }
 
             // Load grid properties
-            mGridProperties.reset(new GridProperties(root.getChildByPath("grid")));
+            mGridProperties.reset(new GridProperties(root->getChildByPath("grid")));
 
             // Load layer stack
-            mLayerStack.reset(new BoardLayerStack(*this, root.getChildByPath("layers")));
+            mLayerStack.reset(new BoardLayerStack(*this, root->getChildByPath("layers")));
 
             // load design rules
-            mDesignRules.reset(new BoardDesignRules(root.getChildByPath("design_rules")));
+            mDesignRules.reset(new BoardDesignRules(root->getChildByPath("design_rules")));
 
             // load fabrication output settings
-            if (const SExpression* child = root.tryGetChildByPath("fabrication_output_settings")) {
+            if (const SExpression* child = root->tryGetChildByPath("fabrication_output_settings")) {
                 mFabricationOutputSettings.reset(new BoardFabricationOutputSettings(*child));
             } else {
                 // backward compatibility - remove this some time!
@@ -247,10 +255,11 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
             }
 
             // load user settings
-            mUserSettings.reset(new BoardUserSettings(*this, restore, readOnly, create));
+            mUserSettings.reset(new BoardUserSettings(*this, mFile->isRestored(),
+                                                      mFile->isReadOnly(), mFile->isCreated()));
 
             // Load all device instances
-            foreach (const SExpression& node, root.getChildren("device")) {
+            foreach (const SExpression& node, root->getChildren("device")) {
                 BI_Device* device = new BI_Device(*this, node);
                 if (getDeviceInstanceByComponentUuid(device->getComponentInstanceUuid())) {
                     throw RuntimeError(__FILE__, __LINE__,
@@ -261,7 +270,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
             }
 
             // Load all netsegments
-            foreach (const SExpression& node, root.getChildren("netsegment")) {
+            foreach (const SExpression& node, root->getChildren("netsegment")) {
                 BI_NetSegment* netsegment = new BI_NetSegment(*this, node);
                 if (getNetSegmentByUuid(netsegment->getUuid())) {
                     throw RuntimeError(__FILE__, __LINE__,
@@ -272,25 +281,25 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
             }
 
             // Load all planes
-            foreach (const SExpression& node, root.getChildren("plane")) {
+            foreach (const SExpression& node, root->getChildren("plane")) {
                 BI_Plane* plane = new BI_Plane(*this, node);
                 mPlanes.append(plane);
             }
 
             // Load all polygons
-            foreach (const SExpression& node, root.getChildren("polygon")) {
+            foreach (const SExpression& node, root->getChildren("polygon")) {
                 BI_Polygon* polygon = new BI_Polygon(*this, node);
                 mPolygons.append(polygon);
             }
 
             // Load all stroke texts
-            foreach (const SExpression& node, root.getChildren("stroke_text")) {
+            foreach (const SExpression& node, root->getChildren("stroke_text")) {
                 BI_StrokeText* text = new BI_StrokeText(*this, node);
                 mStrokeTexts.append(text);
             }
 
             // Load all holes
-            foreach (const SExpression& node, root.getChildren("hole")) {
+            foreach (const SExpression& node, root->getChildren("hole")) {
                 BI_Hole* hole = new BI_Hole(*this, node);
                 mHoles.append(hole);
             }
@@ -325,6 +334,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
     catch (...)
     {
         // free the allocated memory in the reverse order of their allocation...
+        mProject.getErcMsgList().cancelUpdate(*this);
         qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
         qDeleteAll(mAirWires);          mAirWires.clear();
         qDeleteAll(mHoles);             mHoles.clear();
@@ -333,6 +343,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
         qDeleteAll(mPlanes);            mPlanes.clear();
         qDeleteAll(mNetSegments);       mNetSegments.clear();
         qDeleteAll(mDeviceInstances);   mDeviceInstances.clear();
+        qDeleteAll(mNetLineBatches);    mNetLineBatches.clear();
         mUserSettings.reset();
         mFabricationOutputSettings.reset();
         mDesignRules.reset();
@@ -346,6 +357,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
 
 Board::~Board() noexcept
 {
+    mProject.getErcMsgList().cancelUpdate(*this);
     Q_ASSERT(!mIsAddedToProject);
 
     qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
@@ -358,6 +370,7 @@ Board::~Board() noexcept
     qDeleteAll(mPlanes);            mPlanes.clear();
     qDeleteAll(mNetSegments);       mNetSegments.clear();
     qDeleteAll(mDeviceInstances);   mDeviceInstances.clear();
+    qDeleteAll(mNetLineBatches);    mNetLineBatches.clear();
 
     mUserSettings.reset();
     mFabricationOutputSettings.reset();
@@ -499,7 +512,7 @@ QList<BI_FootprintPad*> Board::getPadsAtScenePos(const Point& pos, const Graphic
         foreach (BI_FootprintPad* pad, device->getFootprint().getPads())
         {
             if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
-                && ((!layer) || (pad->isOnLayer(layer->getName())))
+                && ((!layer) || (pad->isOnLayer(layer->getId())))
                 && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
             {
                 list.append(pad);
@@ -529,6 +542,19 @@ QList<BI_Base*> Board::getAllItems() const noexcept
     return items;
 }
 
+BGI_NetLineBatch& Board::getNetLineBatch(const GraphicsLayer& layer,
+                                         const PositiveLength& width) noexcept
+{
+    QPair<const GraphicsLayer*, qint64> key(&layer, width->toNm());
+    BGI_NetLineBatch* batch = mNetLineBatches.value(key, nullptr);
+    if (!batch) {
+        batch = new BGI_NetLineBatch(layer, width);
+        mNetLineBatches.insert(key, batch);
+        mGraphicsScene->addItem(*batch);
+    }
+    return *batch;
+}
+
 /*****************************************************************************************
  *  Setters: General
  ****************************************************************************************/
@@ -538,6 +564,17 @@ void Board::setGridProperties(const GridProperties& grid) noexcept
     *mGridProperties = grid;
 }
 
+void Board::setNetLineBatchingEnabled(bool enabled) noexcept
+{
+    if (enabled == mNetLineBatchingEnabled) return;
+    mNetLineBatchingEnabled = enabled;
+    foreach (BI_NetSegment* netsegment, mNetSegments) {
+        foreach (BI_NetLine* netline, netsegment->getNetLines()) {
+            netline->updateBatch();
+        }
+    }
+}
+
 /*****************************************************************************************
  *  DeviceInstance Methods
  ****************************************************************************************/
@@ -972,6 +1009,11 @@ void Board::serialize(SExpression& root) const
 }
 
 void Board::updateErcMessages() noexcept
+{
+    mProject.getErcMsgList().scheduleUpdate(*this);
+}
+
+void Board::evaluateErcMessages() noexcept
 {
     // type: UnplacedComponent (ComponentInstances without DeviceInstance)
     if (mIsAddedToProject)
@@ -1013,7 +1055,8 @@ void Board::updateErcMessages() noexcept
 
 Board* Board::create(Project& project, const FilePath& filepath, const ElementName& name)
 {
-    return new Board(project, filepath, false, false, true, *name);
+    std::unique_ptr<SmartSExprFile> file(SmartSExprFile::create(filepath)); // can throw
+    return new Board(project, std::move(file), nullptr, *name);
 }
 
 /*****************************************************************************************
@@ -67,6 +67,7 @@ class BoardLayerStack;
 class BoardFabricationOutputSettings;
 class BoardUserSettings;
 class BoardSelectionQuery;
+class BGI_NetLineBatch;
 
 /*****************************************************************************************
  *  Class Board
@@ -113,8 +114,18 @@ class Board final : public QObject, public AttributeProvider,
         Board() = delete;
         Board(const Board& other) = delete;
         Board(const Board& other, const FilePath& filepath, const ElementName& name);
-        Board(Project& project, const FilePath& filepath, bool restore, bool readOnly) :
-            Board(project, filepath, restore, readOnly, false, QString()) {}
+
+        /**
+         * @brief Open an existing board
+         *
+         * @param project   The project of the board
+         * @param file      The opened board file
+         * @param root      The already parsed content of @p file (see
+         *                  SmartSExprFile::parseFileAndBuildDomTree()), which allows
+         *                  to parse the files of several boards in parallel
+         */
+        Board(Project& project, std::unique_ptr<SmartSExprFile> file,
+              const SExpression& root);
         ~Board() noexcept;
 
         // Getters: General
@@ -138,9 +149,13 @@ class Board final : public QObject, public AttributeProvider,
         QList<BI_FootprintPad*> getPadsAtScenePos(const Point& pos, const GraphicsLayer* layer,
                                                   const NetSignal* netsignal) const noexcept;
         QList<BI_Base*> getAllItems() const noexcept;
+        bool isNetLineBatchingEnabled() const noexcept {return mNetLineBatchingEnabled;}
+        BGI_NetLineBatch& getNetLineBatch(const GraphicsLayer& layer,
+                                          const PositiveLength& width) noexcept;
 
         // Setters: General
         void setGridProperties(const GridProperties& grid) noexcept;
+        void setNetLineBatchingEnabled(bool enabled) noexcept;
 
         // Getters: Attributes
         const Uuid& getUuid() const noexcept {return mUuid;}
@@ -224,10 +239,11 @@ class Board final : public QObject, public AttributeProvider,
 
     private:
 
-        Board(Project& project, const FilePath& filepath, bool restore,
-              bool readOnly, bool create, const QString& newName);
+        Board(Project& project, std::unique_ptr<SmartSExprFile> file,
+              const SExpression* root, const QString& newName);
         void updateIcon() noexcept;
         void updateErcMessages() noexcept;
+        void evaluateErcMessages() noexcept override;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -247,6 +263,8 @@ class Board final : public QObject, public AttributeProvider,
         QScopedPointer<BoardUserSettings> mUserSettings;
         QRectF mViewRect;
         QSet<NetSignal*> mScheduledNetSignalsForAirWireRebuild;
+        bool mNetLineBatchingEnabled;
+        QHash<QPair<const GraphicsLayer*, qint64>, BGI_NetLineBatch*> mNetLineBatches;
 
         // Attributes
         Uuid mUuid;
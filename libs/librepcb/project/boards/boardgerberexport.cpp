@@ -25,7 +25,6 @@
 #include <librepcb/common/cam/gerbergenerator.h>
 #include <librepcb/common/cam/excellongenerator.h>
 #include <librepcb/common/graphics/graphicslayer.h>
-#include <librepcb/common/boarddesignrules.h>
 #include <librepcb/common/geometry/hole.h>
 #include <librepcb/common/attributes/attributesubstitutor.h>
 #include <librepcb/library/pkg/footprint.h>
@@ -33,6 +32,7 @@
 #include "../metadata/projectmetadata.h"
 #include "../project.h"
 #include "board.h"
+#include "boardlayeritemvisitor.h"
 #include "boardlayerstack.h"
 #include "boardfabricationoutputsettings.h"
 #include "items/bi_device.h"
@@ -53,6 +53,148 @@
 namespace librepcb {
 namespace project {
 
+/*****************************************************************************************
+ *  Class BoardGerberExport::LayerPainter
+ ****************************************************************************************/
+
+class BoardGerberExport::LayerPainter final : public BoardLayerItemVisitor
+{
+    public:
+        LayerPainter(const BoardGerberExport& exp, GerberGenerator& gen,
+                     const QString& layerName) noexcept :
+            BoardLayerItemVisitor(exp.mBoard), mGenerator(gen), mLayerName(layerName)
+        {
+        }
+
+    protected:
+        void visitFootprintPad(const BI_FootprintPad& pad, const Length& expansion) override {
+            const library::FootprintPad& libPad = pad.getLibPad();
+            Angle rot = pad.getIsMirrored() ? -pad.getRotation() : pad.getRotation();
+            Length width = *libPad.getWidth() + expansion*2;
+            Length height = *libPad.getHeight() + expansion*2;
+            if ((width <= 0) || (height <= 0)) {
+                qWarning() << "Pad with zero size ignored in gerber export:" << pad.getLibPadUuid();
+                return;
+            }
+            UnsignedLength uWidth(width);
+            UnsignedLength uHeight(height);
+            switch (libPad.getShape())
+            {
+                case library::FootprintPad::Shape::ROUND: {
+                    if (width == height) {
+                        mGenerator.flashCircle(pad.getPosition(), uWidth, UnsignedLength(0));
+                    } else {
+                        mGenerator.flashObround(pad.getPosition(), uWidth, uHeight, rot,
+                                                UnsignedLength(0));
+                    }
+                    break;
+                }
+                case library::FootprintPad::Shape::RECT: {
+                    mGenerator.flashRect(pad.getPosition(), uWidth, uHeight, rot, UnsignedLength(0));
+                    break;
+                }
+                case library::FootprintPad::Shape::OCTAGON: {
+                    if (width != height) {
+                        throw LogicError(__FILE__, __LINE__, BoardGerberExport::tr(
+                            "Sorry, non-square octagons are not yet supported."));
+                    }
+                    mGenerator.flashRegularPolygon(pad.getPosition(), uWidth, 8, rot,
+                                                   UnsignedLength(0));
+                    break;
+                }
+                default: {
+                    throw LogicError(__FILE__, __LINE__);
+                }
+            }
+        }
+
+        void visitVia(const BI_Via& via, const Length& expansion) override {
+            UnsignedLength outerDiameter(*via.getSize() + expansion*2);
+            switch (via.getShape())
+            {
+                case BI_Via::Shape::Round: {
+                    mGenerator.flashCircle(via.getPosition(), outerDiameter, UnsignedLength(0));
+                    break;
+                }
+                case BI_Via::Shape::Square: {
+                    mGenerator.flashRect(via.getPosition(), outerDiameter, outerDiameter,
+                                         Angle::deg0(), UnsignedLength(0));
+                    break;
+                }
+                case BI_Via::Shape::Octagon: {
+                    mGenerator.flashRegularPolygon(via.getPosition(), outerDiameter, 8,
+                                                   Angle::deg0(), UnsignedLength(0));
+                    break;
+                }
+                default: {
+                    throw LogicError(__FILE__, __LINE__);
+                }
+            }
+        }
+
+        void visitNetLine(const BI_NetLine& netline) override {
+            mGenerator.drawLine(netline.getStartPoint().getPosition(),
+                                netline.getEndPoint().getPosition(),
+                                positiveToUnsigned(netline.getWidth()));
+        }
+
+        void visitPlaneFragment(const Path& fragment) override {
+            mGenerator.drawPathArea(fragment);
+        }
+
+        void visitPolygon(const Polygon& polygon) override {
+            mGenerator.drawPathOutline(polygon.getPath(),
+                                       calcWidthOfLayer(polygon.getLineWidth(), mLayerName));
+        }
+
+        void visitStrokeText(const BI_StrokeText& text) override {
+            UnsignedLength lineWidth = calcWidthOfLayer(text.getText().getStrokeWidth(), mLayerName);
+            foreach (Path path, text.getText().getPaths()) {
+                path.rotate(text.getText().getRotation());
+                if (text.getText().getMirrored()) path.mirror(Qt::Horizontal);
+                path.translate(text.getPosition());
+                mGenerator.drawPathOutline(path, lineWidth);
+            }
+        }
+
+        void visitHole(const BI_Hole& hole) override {
+            Q_UNUSED(hole); // holes are exported to the Excellon drill files
+        }
+
+        void visitFootprintPolygon(const BI_Footprint& footprint,
+                                   const Polygon& polygon) override {
+            Path path = polygon.getPath();
+            path.rotate(footprint.getRotation());
+            if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
+            path.translate(footprint.getPosition());
+            mGenerator.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), mLayerName));
+            if (polygon.isFilled()) {
+                mGenerator.drawPathArea(path);
+            }
+        }
+
+        void visitFootprintCircle(const BI_Footprint& footprint,
+                                  const Circle& circle) override {
+            Circle e = circle;
+            if (footprint.getIsMirrored()) e.setCenter(e.getCenter().mirrored(Qt::Horizontal));
+            e.translate(footprint.getPosition());
+            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), mLayerName));
+            mGenerator.drawCircleOutline(e);
+            if (e.isFilled()) {
+                mGenerator.drawCircleArea(e);
+            }
+        }
+
+        void visitFootprintHole(const BI_Footprint& footprint, const Hole& hole) override {
+            Q_UNUSED(footprint); // holes are exported to the Excellon drill files
+            Q_UNUSED(hole);
+        }
+
+    private:
+        GerberGenerator& mGenerator;
+        QString mLayerName;
+};
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -331,8 +473,8 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const
     }
 
     // vias
-    foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) {
-        foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) {
+    foreach (const BI_NetSegment* netsegment, BoardLayerItemVisitor::sortedByUuid(mBoard.getNetSegments())) {
+        foreach (const BI_Via* via, BoardLayerItemVisitor::sortedByUuid(netsegment->getVias())) {
             gen.drill(via->getPosition(), via->getDrillDiameter());
             ++count;
         }
@@ -343,207 +485,8 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const
 
 void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName) const
 {
-    // draw footprints incl. pads
-    foreach (const BI_Device* device, mBoard.getDeviceInstances()) { Q_ASSERT(device);
-        drawFootprint(gen, device->getFootprint(), layerName);
-    }
-
-    // draw vias
-    foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
-        foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) { Q_ASSERT(via);
-            drawVia(gen, *via, layerName);
-        }
-    }
-
-    // draw traces
-    foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
-        foreach (const BI_NetLine* netline, sortedByUuid(netsegment->getNetLines())) { Q_ASSERT(netline);
-            if (netline->getLayer().getName() == layerName) {
-                gen.drawLine(netline->getStartPoint().getPosition(),
-                             netline->getEndPoint().getPosition(),
-                             positiveToUnsigned(netline->getWidth()));
-            }
-        }
-    }
-
-    // draw planes
-    foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) { Q_ASSERT(plane);
-        if (plane->getLayerName() == layerName) {
-            foreach (const Path& fragment, plane->getFragments()) {
-                gen.drawPathArea(fragment);
-            }
-        }
-    }
-
-    // draw polygons
-    foreach (const BI_Polygon* polygon, sortedByUuid(mBoard.getPolygons())) {
-        Q_ASSERT(polygon);
-        if (layerName == polygon->getPolygon().getLayerName()) {
-            UnsignedLength lineWidth = calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
-            gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth);
-        }
-    }
-
-    // draw stroke texts
-    foreach (const BI_StrokeText* text, sortedByUuid(mBoard.getStrokeTexts())) { Q_ASSERT(text);
-        if (layerName == text->getText().getLayerName()) {
-            UnsignedLength lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-            foreach (Path path, text->getText().getPaths()) {
-                path.rotate(text->getText().getRotation());
-                if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
-                path.translate(text->getText().getPosition());
-                gen.drawPathOutline(path, lineWidth);
-            }
-        }
-    }
-}
-
-void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const
-{
-    bool drawCopper = via.isOnLayer(layerName);
-    bool drawStopMask = (layerName == GraphicsLayer::sTopStopMask || layerName == GraphicsLayer::sBotStopMask)
-                        && mBoard.getDesignRules().doesViaRequireStopMask(*via.getDrillDiameter());
-    if (drawCopper || drawStopMask) {
-        UnsignedLength outerDiameter = positiveToUnsigned(via.getSize());
-        if (drawStopMask) {
-            outerDiameter += UnsignedLength(mBoard.getDesignRules().calcStopMaskClearance(*via.getSize()) * 2);
-        }
-        switch (via.getShape())
-        {
-            case BI_Via::Shape::Round: {
-                gen.flashCircle(via.getPosition(), outerDiameter, UnsignedLength(0));
-                break;
-            }
-            case BI_Via::Shape::Square: {
-                gen.flashRect(via.getPosition(), outerDiameter, outerDiameter,
-                              Angle::deg0(), UnsignedLength(0));
-                break;
-            }
-            case BI_Via::Shape::Octagon: {
-                gen.flashRegularPolygon(via.getPosition(), outerDiameter, 8,
-                                        Angle::deg0(), UnsignedLength(0));
-                break;
-            }
-            default: {
-                throw LogicError(__FILE__, __LINE__);
-            }
-        }
-    }
-}
-
-void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const
-{
-    // draw pads
-    foreach (const BI_FootprintPad* pad, footprint.getPads()) {
-        drawFootprintPad(gen, *pad, layerName);
-    }
-
-    // draw polygons
-    for (const Polygon& polygon : footprint.getLibFootprint().getPolygons().sortedByUuid()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == polygon.getLayerName()) {
-            Path path = polygon.getPath();
-            path.rotate(footprint.getRotation());
-            if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
-            path.translate(footprint.getPosition());
-            gen.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), layer));
-            if (polygon.isFilled()) {
-                gen.drawPathArea(path);
-            }
-        }
-    }
-
-    // draw circles
-    for (const Circle& circle : footprint.getLibFootprint().getCircles().sortedByUuid()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == circle.getLayerName()) {
-            Circle e = circle;
-            if (footprint.getIsMirrored()) e.setCenter(e.getCenter().mirrored(Qt::Horizontal));
-            e.translate(footprint.getPosition());
-            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), layer));
-            gen.drawCircleOutline(e);
-            if (e.isFilled()) {
-                gen.drawCircleArea(e);
-            }
-        }
-    }
-
-    // draw stroke texts (from footprint instance, *NOT* from library footprint!)
-    foreach (const BI_StrokeText* text, sortedByUuid(footprint.getStrokeTexts())) {
-        if (layerName == text->getText().getLayerName()) {
-            UnsignedLength lineWidth = calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-            foreach (Path path, text->getText().getPaths()) {
-                path.rotate(text->getText().getRotation());
-                if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
-                path.translate(text->getPosition());
-                gen.drawPathOutline(path, lineWidth);
-            }
-        }
-    }
-}
-
-void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const
-{
-    bool isSmt = pad.getLibPad().getBoardSide() != library::FootprintPad::BoardSide::THT;
-    bool isOnCopperLayer = pad.isOnLayer(layerName);
-    bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopStopMask);
-    bool isOnSolderMaskBottom = pad.isOnLayer(GraphicsLayer::sBotCopper) && (layerName == GraphicsLayer::sBotStopMask);
-    bool isOnSolderPasteTop = isSmt && pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopSolderPaste);
-    bool isOnSolderPasteBottom = isSmt && pad.isOnLayer(GraphicsLayer::sBotCopper) && (layerName == GraphicsLayer::sBotSolderPaste);
-    if (!isOnCopperLayer && !isOnSolderMaskTop && !isOnSolderMaskBottom && !isOnSolderPasteTop && !isOnSolderPasteBottom) {
-        return;
-    }
-
-    Angle rot = pad.getIsMirrored() ? -pad.getRotation() : pad.getRotation();
-    const library::FootprintPad& libPad = pad.getLibPad();
-    Length width = *libPad.getWidth();
-    Length height = *libPad.getHeight();
-    if (isOnSolderMaskTop || isOnSolderMaskBottom) {
-        Length size = qMin(width, height);
-        UnsignedLength clearance = mBoard.getDesignRules().calcStopMaskClearance(size);
-        width += clearance*2;
-        height += clearance*2;
-    } else if (isOnSolderPasteTop || isOnSolderPasteBottom) {
-        Length size = qMin(width, height);
-        Length clearance = -mBoard.getDesignRules().calcCreamMaskClearance(size);
-        width += clearance*2;
-        height += clearance*2;
-    }
-
-    if ((width <= 0) || (height <= 0)) {
-        qWarning() << "Pad with zero size ignored in gerber export:" << pad.getLibPadUuid();
-        return;
-    }
-
-    UnsignedLength uWidth(width);
-    UnsignedLength uHeight(height);
-
-    switch (libPad.getShape())
-    {
-        case library::FootprintPad::Shape::ROUND: {
-            if (width == height) {
-                gen.flashCircle(pad.getPosition(), uWidth, UnsignedLength(0));
-            } else {
-                gen.flashObround(pad.getPosition(), uWidth, uHeight, rot, UnsignedLength(0));
-            }
-            break;
-        }
-        case library::FootprintPad::Shape::RECT: {
-            gen.flashRect(pad.getPosition(), uWidth, uHeight, rot, UnsignedLength(0));
-            break;
-        }
-        case library::FootprintPad::Shape::OCTAGON: {
-            if (width != height) {
-                throw LogicError(__FILE__, __LINE__,
-                    tr("Sorry, non-square octagons are not yet supported."));
-            }
-            gen.flashRegularPolygon(pad.getPosition(), uWidth, 8, rot, UnsignedLength(0));
-            break;
-        }
-        default: {
-            throw LogicError(__FILE__, __LINE__);
-        }
-    }
+    LayerPainter painter(*this, gen, layerName);
+    painter.visitLayer(GraphicsLayerId(layerName)); // can throw
 }
 
 FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const noexcept
@@ -42,9 +42,6 @@ namespace project {
 
 class Project;
 class Board;
-class BI_Via;
-class BI_Footprint;
-class BI_FootprintPad;
 
 /*****************************************************************************************
  *  Class BoardGerberExport
@@ -91,6 +88,9 @@ class BoardGerberExport final : public QObject, public AttributeProvider
 
     private:
 
+        // Types
+        class LayerPainter;
+
         // Private Methods
         void exportDrills() const;
         void exportDrillsNpth() const;
@@ -109,22 +109,11 @@ class BoardGerberExport final : public QObject, public AttributeProvider
         int drawNpthDrills(ExcellonGenerator& gen) const;
         int drawPthDrills(ExcellonGenerator& gen) const;
         void drawLayer(GerberGenerator& gen, const QString& layerName) const;
-        void drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const;
-        void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const;
-        void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const;
 
         FilePath getOutputFilePath(const QString& suffix) const noexcept;
 
         // Static Methods
         static UnsignedLength calcWidthOfLayer(const UnsignedLength& width, const QString& name) noexcept;
-        template <typename T>
-        static QList<T*> sortedByUuid(const QList<T*>& list) noexcept {
-            // sort a list of objects by their UUID to get reproducable gerber files
-            QList<T*> copy = list;
-            qSort(copy.begin(), copy.end(),
-                  [](const T* o1, const T* o2){return o1->getUuid() < o2->getUuid();});
-            return copy;
-        }
 
 
         // Private Member Variables
@@ -0,0 +1,224 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "boardlayeritemvisitor.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/boarddesignrules.h>
+#include <librepcb/common/geometry/circle.h>
+#include <librepcb/common/geometry/hole.h>
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/geometry/stroketext.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/footprintpad.h>
+#include "board.h"
+#include "items/bi_device.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_via.h"
+#include "items/bi_netsegment.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_netline.h"
+#include "items/bi_plane.h"
+#include "items/bi_polygon.h"
+#include "items/bi_stroketext.h"
+#include "items/bi_hole.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardLayerItemVisitor::BoardLayerItemVisitor(const Board& board) noexcept :
+    mBoard(board)
+{
+}
+
+BoardLayerItemVisitor::~BoardLayerItemVisitor() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BoardLayerItemVisitor::visitLayer(const GraphicsLayerId& layer)
+{
+    const QString& layerName = layer.getName();
+
+    // footprints incl. pads
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) { Q_ASSERT(device);
+        visitFootprint(device->getFootprint(), layer);
+    }
+
+    // vias
+    foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
+        foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) { Q_ASSERT(via);
+            visitViaIfOnLayer(*via, layer);
+        }
+    }
+
+    // traces
+    foreach (const BI_NetSegment* netsegment, sortedByUuid(mBoard.getNetSegments())) { Q_ASSERT(netsegment);
+        foreach (const BI_NetLine* netline, sortedByUuid(netsegment->getNetLines())) { Q_ASSERT(netline);
+            if (netline->getLayer().getId() == layer) {
+                visitNetLine(*netline);
+            }
+        }
+    }
+
+    // planes
+    foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) { Q_ASSERT(plane);
+        if (plane->getLayerName() == layerName) {
+            foreach (const Path& fragment, plane->getFragments()) {
+                visitPlaneFragment(fragment);
+            }
+        }
+    }
+
+    // polygons
+    foreach (const BI_Polygon* polygon, sortedByUuid(mBoard.getPolygons())) { Q_ASSERT(polygon);
+        if (polygon->getPolygon().getLayerName() == layerName) {
+            visitPolygon(polygon->getPolygon());
+        }
+    }
+
+    // stroke texts
+    foreach (const BI_StrokeText* text, sortedByUuid(mBoard.getStrokeTexts())) { Q_ASSERT(text);
+        if (text->getText().getLayerName() == layerName) {
+            visitStrokeText(*text);
+        }
+    }
+
+    // holes
+    if (layerName == GraphicsLayer::sBoardDrillsNpth) {
+        foreach (const BI_Hole* hole, sortedByUuid(mBoard.getHoles())) { Q_ASSERT(hole);
+            visitHole(*hole);
+        }
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BoardLayerItemVisitor::visitFootprint(const BI_Footprint& footprint,
+                                           const GraphicsLayerId& layer)
+{
+    // pads
+    foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+        visitFootprintPadIfOnLayer(*pad, layer);
+    }
+
+    // the layer of the library footprint elements to visit
+    const QString libLayerName = footprint.getIsMirrored() ? layer.getMirrored().getName()
+                                                           : layer.getName();
+
+    // polygons
+    for (const Polygon& polygon : footprint.getLibFootprint().getPolygons().sortedByUuid()) {
+        if (polygon.getLayerName() == libLayerName) {
+            visitFootprintPolygon(footprint, polygon);
+        }
+    }
+
+    // circles
+    for (const Circle& circle : footprint.getLibFootprint().getCircles().sortedByUuid()) {
+        if (circle.getLayerName() == libLayerName) {
+            visitFootprintCircle(footprint, circle);
+        }
+    }
+
+    // holes
+    if (layer.getName() == GraphicsLayer::sBoardDrillsNpth) {
+        for (const Hole& hole : footprint.getLibFootprint().getHoles().sortedByUuid()) {
+            visitFootprintHole(footprint, hole);
+        }
+    }
+
+    // stroke texts (from footprint instance, *NOT* from library footprint!)
+    foreach (const BI_StrokeText* text, sortedByUuid(footprint.getStrokeTexts())) {
+        if (text->getText().getLayerName() == layer.getName()) {
+            visitStrokeText(*text);
+        }
+    }
+}
+
+void BoardLayerItemVisitor::visitFootprintPadIfOnLayer(const BI_FootprintPad& pad,
+                                                       const GraphicsLayerId& layer)
+{
+    static const GraphicsLayerId topCopper(GraphicsLayer::sTopCopper);
+    static const GraphicsLayerId botCopper(GraphicsLayer::sBotCopper);
+    static const GraphicsLayerId topStopMask(GraphicsLayer::sTopStopMask);
+    static const GraphicsLayerId botStopMask(GraphicsLayer::sBotStopMask);
+    static const GraphicsLayerId topSolderPaste(GraphicsLayer::sTopSolderPaste);
+    static const GraphicsLayerId botSolderPaste(GraphicsLayer::sBotSolderPaste);
+    const library::FootprintPad& libPad = pad.getLibPad();
+    bool isSmt = libPad.getBoardSide() != library::FootprintPad::BoardSide::THT;
+    bool isOnCopperLayer = pad.isOnLayer(layer);
+    bool isOnSolderMask = (pad.isOnLayer(topCopper) && (layer == topStopMask))
+                       || (pad.isOnLayer(botCopper) && (layer == botStopMask));
+    bool isOnSolderPaste = isSmt && ((pad.isOnLayer(topCopper) && (layer == topSolderPaste))
+                                  || (pad.isOnLayer(botCopper) && (layer == botSolderPaste)));
+    if ((!isOnCopperLayer) && (!isOnSolderMask) && (!isOnSolderPaste)) {
+        return;
+    }
+
+    Length expansion(0);
+    Length size = qMin(*libPad.getWidth(), *libPad.getHeight());
+    if (isOnSolderMask) {
+        expansion = *mBoard.getDesignRules().calcStopMaskClearance(size);
+    } else if (isOnSolderPaste) {
+        expansion = -mBoard.getDesignRules().calcCreamMaskClearance(size);
+    }
+    visitFootprintPad(pad, expansion);
+}
+
+void BoardLayerItemVisitor::visitViaIfOnLayer(const BI_Via& via, const GraphicsLayerId& layer)
+{
+    static const GraphicsLayerIdSet stopMaskLayers = {
+        GraphicsLayerId(GraphicsLayer::sTopStopMask),
+        GraphicsLayerId(GraphicsLayer::sBotStopMask),
+    };
+    bool isOnCopperLayer = via.isOnLayer(layer);
+    bool isOnStopMask = stopMaskLayers.contains(layer)
+                        && mBoard.getDesignRules().doesViaRequireStopMask(*via.getDrillDiameter());
+    if (isOnCopperLayer || isOnStopMask) {
+        Length expansion(0);
+        if (isOnStopMask) {
+            expansion = *mBoard.getDesignRules().calcStopMaskClearance(*via.getSize());
+        }
+        visitVia(via, expansion);
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
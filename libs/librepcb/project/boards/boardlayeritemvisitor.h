@@ -0,0 +1,151 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_PROJECT_BOARDLAYERITEMVISITOR_H
+#define LIBREPCB_PROJECT_BOARDLAYERITEMVISITOR_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class Circle;
+class GraphicsLayerId;
+class Hole;
+class Path;
+class Polygon;
+
+namespace project {
+
+class Board;
+class BI_Footprint;
+class BI_FootprintPad;
+class BI_Hole;
+class BI_NetLine;
+class BI_StrokeText;
+class BI_Via;
+
+/*****************************************************************************************
+ *  Class BoardLayerItemVisitor
+ ****************************************************************************************/
+
+/**
+ * @brief Visits all items of a board which appear on a specific board layer
+ *
+ * This is the common base of all exports which take the content of a layer directly
+ * from the board items (librepcb::project::BoardGerberExport and
+ * librepcb::project::BoardSnapshotBuilder), so they agree about which items belong to
+ * a layer and how much pads and vias are expanded on the stop mask and solder paste
+ * layers. The items are visited in the order of their UUIDs to get reproducible
+ * outputs.
+ */
+class BoardLayerItemVisitor
+{
+    public:
+
+        // Constructors / Destructor
+        BoardLayerItemVisitor() = delete;
+        BoardLayerItemVisitor(const BoardLayerItemVisitor& other) = delete;
+        explicit BoardLayerItemVisitor(const Board& board) noexcept;
+        virtual ~BoardLayerItemVisitor() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Call the visit methods for all items on a layer
+         *
+         * @param layer     The layer to visit
+         *
+         * @throw Exception     Any exception thrown by the visit methods
+         */
+        void visitLayer(const GraphicsLayerId& layer);
+
+        // Operator Overloadings
+        BoardLayerItemVisitor& operator=(const BoardLayerItemVisitor& rhs) = delete;
+
+        // Static Methods
+        template <typename T>
+        static QList<T*> sortedByUuid(const QList<T*>& list) noexcept {
+            QList<T*> copy = list;
+            qSort(copy.begin(), copy.end(),
+                  [](const T* o1, const T* o2){return o1->getUuid() < o2->getUuid();});
+            return copy;
+        }
+
+
+    protected: // Methods
+
+        /**
+         * @brief Visit a pad which is on the visited layer
+         *
+         * @param pad           The pad
+         * @param expansion     The stop mask clearance or (negative) cream mask clearance
+         *                      to add on each side of the pad, or zero on copper layers
+         */
+        virtual void visitFootprintPad(const BI_FootprintPad& pad, const Length& expansion) = 0;
+
+        /**
+         * @brief Visit a via which is on the visited layer
+         *
+         * @param via           The via
+         * @param expansion     The stop mask clearance to add on each side of the via, or
+         *                      zero on copper layers
+         */
+        virtual void visitVia(const BI_Via& via, const Length& expansion) = 0;
+
+        virtual void visitNetLine(const BI_NetLine& netline) = 0;
+        virtual void visitPlaneFragment(const Path& fragment) = 0;
+        virtual void visitPolygon(const Polygon& polygon) = 0;
+        virtual void visitStrokeText(const BI_StrokeText& text) = 0;
+        virtual void visitHole(const BI_Hole& hole) = 0;
+
+        // Library footprint elements are passed in footprint coordinates, i.e. they still
+        // need to be transformed with the position, rotation and mirror of the footprint
+        virtual void visitFootprintPolygon(const BI_Footprint& footprint,
+                                           const Polygon& polygon) = 0;
+        virtual void visitFootprintCircle(const BI_Footprint& footprint,
+                                          const Circle& circle) = 0;
+        virtual void visitFootprintHole(const BI_Footprint& footprint, const Hole& hole) = 0;
+
+
+    private: // Methods
+        void visitFootprint(const BI_Footprint& footprint, const GraphicsLayerId& layer);
+        void visitFootprintPadIfOnLayer(const BI_FootprintPad& pad, const GraphicsLayerId& layer);
+        void visitViaIfOnLayer(const BI_Via& via, const GraphicsLayerId& layer);
+
+
+    protected: // Data
+        const Board& mBoard;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDLAYERITEMVISITOR_H
@@ -73,6 +73,7 @@ BoardLayerStack::BoardLayerStack(Board& board) :
 
 BoardLayerStack::~BoardLayerStack() noexcept
 {
+    mLayersById.clear();
     qDeleteAll(mLayers); mLayers.clear();
 }
 
@@ -227,6 +228,11 @@ void BoardLayerStack::addLayer(GraphicsLayer* layer) noexcept
             this, &BoardLayerStack::layerAttributesChanged,
             Qt::QueuedConnection);
     mLayers.append(layer);
+    int index = layer->getId().toInt();
+    if (index >= mLayersById.count()) {
+        mLayersById.resize(index + 1);
+    }
+    mLayersById[index] = layer;
 }
 
 /*****************************************************************************************
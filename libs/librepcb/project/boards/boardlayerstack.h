@@ -68,12 +68,13 @@ class BoardLayerStack final : public QObject, public SerializableObject,
 
         /// @copydoc IF_BoardLayerProvider#getLayer()
         GraphicsLayer* getLayer(const QString& name) const noexcept override {
-            foreach (GraphicsLayer* layer, mLayers) {
-                if (layer->getName() == name) {
-                    return layer;
-                }
-            }
-            return nullptr;
+            return getLayer(GraphicsLayerId::find(name));
+        }
+
+        /// Same as #getLayer(const QString&), but without any string operations
+        GraphicsLayer* getLayer(const GraphicsLayerId& id) const noexcept {
+            int index = id.toInt();
+            return ((index >= 0) && (index < mLayersById.count())) ? mLayersById.at(index) : nullptr;
         }
 
         // Setters
@@ -102,6 +103,7 @@ class BoardLayerStack final : public QObject, public SerializableObject,
         // General
         Board& mBoard; ///< A reference to the Board object (from the ctor)
         QList<GraphicsLayer*> mLayers;
+        QVector<GraphicsLayer*> mLayersById; ///< indexed by librepcb::GraphicsLayerId::toInt()
         bool mLayersChanged;
 
         // Settings
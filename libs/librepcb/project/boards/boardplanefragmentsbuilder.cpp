@@ -122,6 +122,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
 {
     ClipperLib::Clipper c;
     c.AddPaths(mResult, ClipperLib::ptSubject, true);
+    GraphicsLayerId layer(*mPlane.getLayerName());
 
     // subtract other planes
     foreach (const BI_Plane* plane, mPlane.getBoard().getPlanes()) {
@@ -145,7 +146,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
                       ClipperLib::ptClip, true);
         }
         foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
-            if (!pad->isOnLayer(*mPlane.getLayerName())) continue;
+            if (!pad->isOnLayer(layer)) continue;
             if (pad->getCompSigInstNetSignal() == &mPlane.getNetSignal()) {
                 ClipperLib::Path path = ClipperHelpers::convert(pad->getSceneOutline(),
                                                                 maxArcTolerance());
@@ -178,7 +179,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
 
         // subtract netlines
         foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-            if (netline->getLayer().getName() != mPlane.getLayerName()) continue;
+            if (netline->getLayer().getId() != layer) continue;
             if (&netsegment->getNetSignal() == &mPlane.getNetSignal()) {
                 ClipperLib::Path path = ClipperHelpers::convert(netline->getSceneOutline(),
                                                                 maxArcTolerance());
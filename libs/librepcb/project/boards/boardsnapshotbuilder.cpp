@@ -0,0 +1,191 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "boardsnapshotbuilder.h"
+#include "boardlayeritemvisitor.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/geometry/circle.h>
+#include <librepcb/common/geometry/hole.h>
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/geometry/stroketext.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/footprintpad.h>
+#include "board.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_via.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_netline.h"
+#include "items/bi_stroketext.h"
+#include "items/bi_hole.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardSnapshotBuilder::BoardSnapshotBuilder(const Board& board) noexcept :
+    mBoard(board)
+{
+}
+
+BoardSnapshotBuilder::~BoardSnapshotBuilder() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Class BoardSnapshotBuilder::LayerPainter
+ ****************************************************************************************/
+
+class BoardSnapshotBuilder::LayerPainter final : public BoardLayerItemVisitor
+{
+    public:
+        LayerPainter(const Board& board, const GraphicsLayer& layer,
+                     GraphicsSnapshot& snapshot) noexcept :
+            BoardLayerItemVisitor(board), mLayer(layer), mSnapshot(snapshot),
+            mBrush(layer.getColor(), Qt::SolidPattern)
+        {
+        }
+
+    protected:
+        void visitFootprintPad(const BI_FootprintPad& pad, const Length& expansion) override {
+            mSnapshot.drawPath(pad.getLibPad().toQPainterPathPx(expansion), Qt::NoPen, mBrush,
+                               getTransform(pad.getPosition(), pad.getRotation(),
+                                            pad.getIsMirrored()));
+        }
+
+        void visitVia(const BI_Via& via, const Length& expansion) override {
+            mSnapshot.drawPath(via.toQPainterPathPx(expansion), Qt::NoPen, mBrush,
+                               getTransform(via.getPosition(), Angle::deg0(), false));
+        }
+
+        void visitNetLine(const BI_NetLine& netline) override {
+            mSnapshot.drawLine(QLineF(netline.getStartPoint().getPosition().toPxQPointF(),
+                                      netline.getEndPoint().getPosition().toPxQPointF()),
+                               getPen(mLayer, positiveToUnsigned(netline.getWidth())));
+        }
+
+        void visitPlaneFragment(const Path& fragment) override {
+            mSnapshot.drawPath(fragment.toQPainterPathPx(), Qt::NoPen, mBrush);
+        }
+
+        void visitPolygon(const Polygon& polygon) override {
+            mSnapshot.drawPath(polygon.getPath().toQPainterPathPx(),
+                               getPen(mLayer, polygon.getLineWidth()),
+                               polygon.isFilled() ? mBrush : Qt::NoBrush);
+        }
+
+        void visitStrokeText(const BI_StrokeText& text) override {
+            const StrokeText& t = text.getText();
+            mSnapshot.drawPath(Path::toQPainterPathPx(t.getPaths()),
+                               getPen(mLayer, t.getStrokeWidth()), Qt::NoBrush,
+                               getTransform(text.getPosition(), t.getRotation(), t.getMirrored()));
+        }
+
+        void visitHole(const BI_Hole& hole) override {
+            qreal radius = hole.getHole().getDiameter()->toPx() / 2;
+            mSnapshot.drawEllipse(hole.getHole().getPosition().toPxQPointF(), radius, radius,
+                                  Qt::NoPen, mBrush);
+        }
+
+        void visitFootprintPolygon(const BI_Footprint& footprint,
+                                   const Polygon& polygon) override {
+            mSnapshot.drawPath(polygon.getPath().toQPainterPathPx(),
+                               getPen(mLayer, polygon.getLineWidth()),
+                               polygon.isFilled() ? mBrush : Qt::NoBrush,
+                               getFootprintTransform(footprint));
+        }
+
+        void visitFootprintCircle(const BI_Footprint& footprint,
+                                  const Circle& circle) override {
+            qreal radius = circle.getDiameter()->toPx() / 2;
+            mSnapshot.drawEllipse(circle.getCenter().toPxQPointF(), radius, radius,
+                                  getPen(mLayer, circle.getLineWidth()),
+                                  circle.isFilled() ? mBrush : Qt::NoBrush,
+                                  getFootprintTransform(footprint));
+        }
+
+        void visitFootprintHole(const BI_Footprint& footprint, const Hole& hole) override {
+            qreal radius = hole.getDiameter()->toPx() / 2;
+            mSnapshot.drawEllipse(hole.getPosition().toPxQPointF(), radius, radius,
+                                  Qt::NoPen, mBrush, getFootprintTransform(footprint));
+        }
+
+    private:
+        static QTransform getFootprintTransform(const BI_Footprint& footprint) noexcept {
+            return getTransform(footprint.getPosition(), footprint.getRotation(),
+                                footprint.getIsMirrored());
+        }
+
+        const GraphicsLayer& mLayer;
+        GraphicsSnapshot& mSnapshot;
+        const QBrush mBrush;
+};
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+GraphicsSnapshot BoardSnapshotBuilder::buildLayer(const GraphicsLayer& layer) const noexcept
+{
+    GraphicsSnapshot snapshot;
+    try {
+        LayerPainter painter(mBoard, layer, snapshot);
+        painter.visitLayer(layer.getId());
+    } catch (const Exception& e) {
+        qCritical() << "Failed to record board layer" << layer.getName() << ":" << e.getMsg();
+    }
+    return snapshot;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QPen BoardSnapshotBuilder::getPen(const GraphicsLayer& layer,
+                                  const UnsignedLength& width) noexcept
+{
+    return QPen(layer.getColor(), width->toPx(), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin);
+}
+
+QTransform BoardSnapshotBuilder::getTransform(const Point& pos, const Angle& rot,
+                                              bool mirror) noexcept
+{
+    // same transformation as used for the graphics items
+    QTransform t;
+    if (mirror) t.scale(qreal(-1), qreal(1));
+    t.rotate(-rot.toDeg());
+    return t * QTransform::fromTranslate(pos.toPxQPointF().x(), pos.toPxQPointF().y());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,100 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDSNAPSHOTBUILDER_H
+#define LIBREPCB_PROJECT_BOARDSNAPSHOTBUILDER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include <librepcb/common/graphics/graphicssnapshot.h>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class GraphicsLayer;
+
+namespace project {
+
+class Board;
+
+/*****************************************************************************************
+ *  Class BoardSnapshotBuilder
+ ****************************************************************************************/
+
+/**
+ * @brief Records the content of board layers into librepcb::GraphicsSnapshot objects
+ *
+ * The content is taken directly from the board items with
+ * librepcb::project::BoardLayerItemVisitor (the same way as
+ * librepcb::project::BoardGerberExport does), so the graphics items and the graphics
+ * scene of the board are not involved at all. The snapshots must be built in the thread
+ * the board lives in, but can then be rendered in any thread.
+ */
+class BoardSnapshotBuilder final
+{
+    public:
+
+        // Constructors / Destructor
+        BoardSnapshotBuilder() = delete;
+        BoardSnapshotBuilder(const BoardSnapshotBuilder& other) = delete;
+        explicit BoardSnapshotBuilder(const Board& board) noexcept;
+        ~BoardSnapshotBuilder() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Record all items of a layer, using the color of the layer
+         *
+         * @param layer     The layer to record (must be a layer of the board)
+         *
+         * @return The snapshot (empty if there are no items on the layer)
+         */
+        GraphicsSnapshot buildLayer(const GraphicsLayer& layer) const noexcept;
+
+        // Operator Overloadings
+        BoardSnapshotBuilder& operator=(const BoardSnapshotBuilder& rhs) = delete;
+
+
+    private: // Types
+        class LayerPainter;
+
+
+    private: // Methods
+        static QPen getPen(const GraphicsLayer& layer, const UnsignedLength& width) noexcept;
+        static QTransform getTransform(const Point& pos, const Angle& rot, bool mirror) noexcept;
+
+
+    private: // Data
+        const Board& mBoard;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDSNAPSHOTBUILDER_H
@@ -95,6 +95,26 @@ void CmdBoardNetPointEdit::setDeltaToStartPos(const Point& deltaPos, bool immedi
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdBoardNetPointEdit::canMergeWith(const UndoCommand& other) const noexcept
+{
+    // only merge consecutive edits of the same object
+    const CmdBoardNetPointEdit* cmd = dynamic_cast<const CmdBoardNetPointEdit*>(&other);
+    return cmd && (&cmd->mNetPoint == &mNetPoint) &&
+           (cmd->mOldLayer == mNewLayer) &&
+           (cmd->mOldFootprintPad == mNewFootprintPad) &&
+           (cmd->mOldVia == mNewVia) &&
+           (cmd->mOldPos == mNewPos);
+}
+
+void CmdBoardNetPointEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    const CmdBoardNetPointEdit& cmd = static_cast<const CmdBoardNetPointEdit&>(other);
+    mNewLayer = cmd.mNewLayer;
+    mNewFootprintPad = cmd.mNewFootprintPad;
+    mNewVia = cmd.mNewVia;
+    mNewPos = cmd.mNewPos;
+}
+
 bool CmdBoardNetPointEdit::performExecute()
 {
     performRedo(); // can throw
@@ -64,6 +64,15 @@ class CmdBoardNetPointEdit final : public UndoCommand
         void setDeltaToStartPos(const Point& deltaPos, bool immediate) noexcept;
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::canMergeWith()
+        bool canMergeWith(const UndoCommand& other) const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        void mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
@@ -25,6 +25,9 @@
 #include "../items/bi_netpoint.h"
 #include "../items/bi_netline.h"
 #include "../items/bi_netsegment.h"
+#include "../graphicsitems/bgi_netline.h"
+#include "../graphicsitems/bgi_netpoint.h"
+#include "../graphicsitems/bgi_via.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -108,6 +111,16 @@ BI_NetLine* CmdBoardNetSegmentAddElements::addNetLine(BI_NetPoint& startPoint,
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdBoardNetSegmentAddElements::getEstimatedMemoryUsage() const noexcept
+{
+    // the command keeps the elements (including their graphics items) alive
+    return UndoCommand::getEstimatedMemoryUsage()
+        + sizeof(*this) - sizeof(UndoCommand)
+        + mVias.count() * (sizeof(BI_Via) + sizeof(BGI_Via) + sizeof(BI_Via*))
+        + mNetPoints.count() * (sizeof(BI_NetPoint) + sizeof(BGI_NetPoint) + sizeof(BI_NetPoint*))
+        + mNetLines.count() * (sizeof(BI_NetLine) + sizeof(BGI_NetLine) + sizeof(BI_NetLine*));
+}
+
 bool CmdBoardNetSegmentAddElements::performExecute()
 {
     performRedo(); // can throw
@@ -70,6 +70,11 @@ class CmdBoardNetSegmentAddElements final : public UndoCommand
         BI_NetLine* addNetLine(BI_NetPoint& startPoint, BI_NetPoint& endPoint,
                                const PositiveLength& width);
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getEstimatedMemoryUsage()
+        qint64 getEstimatedMemoryUsage() const noexcept override;
+
 
     private:
 
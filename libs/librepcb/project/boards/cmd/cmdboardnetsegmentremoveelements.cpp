@@ -26,6 +26,10 @@
 #include "../items/bi_netpoint.h"
 #include "../items/bi_netline.h"
 #include "../items/bi_netsegment.h"
+#include "../items/bi_via.h"
+#include "../graphicsitems/bgi_netline.h"
+#include "../graphicsitems/bgi_netpoint.h"
+#include "../graphicsitems/bgi_via.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -70,6 +74,16 @@ void CmdBoardNetSegmentRemoveElements::removeNetLine(BI_NetLine& netline)
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdBoardNetSegmentRemoveElements::getEstimatedMemoryUsage() const noexcept
+{
+    // the command keeps the elements (including their graphics items) alive
+    return UndoCommand::getEstimatedMemoryUsage()
+        + sizeof(*this) - sizeof(UndoCommand)
+        + mVias.count() * (sizeof(BI_Via) + sizeof(BGI_Via) + sizeof(BI_Via*))
+        + mNetPoints.count() * (sizeof(BI_NetPoint) + sizeof(BGI_NetPoint) + sizeof(BI_NetPoint*))
+        + mNetLines.count() * (sizeof(BI_NetLine) + sizeof(BGI_NetLine) + sizeof(BI_NetLine*));
+}
+
 bool CmdBoardNetSegmentRemoveElements::performExecute()
 {
     performRedo(); // can throw
@@ -57,6 +57,11 @@ class CmdBoardNetSegmentRemoveElements final : public UndoCommand
         void removeNetPoint(BI_NetPoint& netpoint);
         void removeNetLine(BI_NetLine& netline);
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getEstimatedMemoryUsage()
+        qint64 getEstimatedMemoryUsage() const noexcept override;
+
 
     private:
 
@@ -127,6 +127,13 @@ void CmdBoardPlaneEdit::setKeepOrphans(bool keepOrphans) noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdBoardPlaneEdit::getEstimatedMemoryUsage() const noexcept
+{
+    return UndoCommand::getEstimatedMemoryUsage()
+        + sizeof(*this) - sizeof(UndoCommand)
+        + (mOldOutline.getVertices().capacity() + mNewOutline.getVertices().capacity()) * sizeof(Vertex);
+}
+
 bool CmdBoardPlaneEdit::performExecute()
 {
     performRedo(); // can throw
@@ -63,6 +63,11 @@ class CmdBoardPlaneEdit final : public UndoCommand
         void setPriority(int priority) noexcept;
         void setKeepOrphans(bool keepOrphans) noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getEstimatedMemoryUsage()
+        qint64 getEstimatedMemoryUsage() const noexcept override;
+
 
     private:
 
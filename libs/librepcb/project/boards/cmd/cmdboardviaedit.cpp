@@ -96,6 +96,26 @@ void CmdBoardViaEdit::setDrillDiameter(const PositiveLength& diameter, bool imme
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdBoardViaEdit::canMergeWith(const UndoCommand& other) const noexcept
+{
+    // only merge consecutive edits of the same object
+    const CmdBoardViaEdit* cmd = dynamic_cast<const CmdBoardViaEdit*>(&other);
+    return cmd && (&cmd->mVia == &mVia) &&
+           (cmd->mOldPos == mNewPos) &&
+           (cmd->mOldShape == mNewShape) &&
+           (*cmd->mOldSize == *mNewSize) &&
+           (*cmd->mOldDrillDiameter == *mNewDrillDiameter);
+}
+
+void CmdBoardViaEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    const CmdBoardViaEdit& cmd = static_cast<const CmdBoardViaEdit&>(other);
+    mNewPos = cmd.mNewPos;
+    mNewShape = cmd.mNewShape;
+    mNewSize = cmd.mNewSize;
+    mNewDrillDiameter = cmd.mNewDrillDiameter;
+}
+
 bool CmdBoardViaEdit::performExecute()
 {
     performRedo(); // can throw
@@ -59,6 +59,15 @@ class CmdBoardViaEdit final : public UndoCommand
         void setDrillDiameter(const PositiveLength& diameter, bool immediate) noexcept;
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::canMergeWith()
+        bool canMergeWith(const UndoCommand& other) const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        void mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
@@ -137,6 +137,29 @@ void CmdDeviceInstanceEdit::mirror(const Point& center, Qt::Orientation orientat
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdDeviceInstanceEdit::canMergeWith(const UndoCommand& other) const noexcept
+{
+    // only merge consecutive edits of the same object
+    const CmdDeviceInstanceEdit* cmd = dynamic_cast<const CmdDeviceInstanceEdit*>(&other);
+    return cmd && (&cmd->mDevice == &mDevice) &&
+           (cmd->mOldPos == mNewPos) &&
+           (cmd->mOldRotation == mNewRotation) &&
+           (cmd->mOldMirrored == mNewMirrored);
+}
+
+void CmdDeviceInstanceEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    const CmdDeviceInstanceEdit& cmd = static_cast<const CmdDeviceInstanceEdit&>(other);
+    mNewPos = cmd.mNewPos;
+    mNewRotation = cmd.mNewRotation;
+    mNewMirrored = cmd.mNewMirrored;
+}
+
+qint64 CmdDeviceInstanceEdit::getEstimatedMemoryUsage() const noexcept
+{
+    return UndoCommand::getEstimatedMemoryUsage() + sizeof(*this) - sizeof(UndoCommand);
+}
+
 bool CmdDeviceInstanceEdit::performExecute()
 {
     performRedo(); // can throw
@@ -60,6 +60,18 @@ class CmdDeviceInstanceEdit final : public UndoCommand
         void mirror(const Point& center, Qt::Orientation orientation, bool immediate);
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::canMergeWith()
+        bool canMergeWith(const UndoCommand& other) const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        void mergeWith(const UndoCommand& other) noexcept override;
+
+        /// @copydoc UndoCommand::getEstimatedMemoryUsage()
+        qint64 getEstimatedMemoryUsage() const noexcept override;
+
+
     private:
 
         // Private Methods
@@ -28,6 +28,7 @@
 #include "../board.h"
 #include "../boardlayerstack.h"
 #include "../../circuit/netsignal.h"
+#include <librepcb/common/graphics/graphicstilecache.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -44,6 +45,7 @@ BGI_AirWire::BGI_AirWire(BI_AirWire& airwire) noexcept :
 {
     mLayer = getLayer(GraphicsLayer::sBoardAirWires);
     setZValue(Board::ZValue_AirWires);
+    GraphicsTileCache::setCacheable(*this, false); // airwires change very often
     updateCacheAndRepaint();
 }
 
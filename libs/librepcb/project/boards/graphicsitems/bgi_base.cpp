@@ -51,20 +51,46 @@ BGI_Base::~BGI_Base() noexcept
 
 qreal BGI_Base::getZValueOfCopperLayer(const QString& name) noexcept
 {
-    if (GraphicsLayer::isTopLayer(name)) {
+    return getZValueOfCopperLayer(GraphicsLayerId(name));
+}
+
+qreal BGI_Base::getZValueOfCopperLayer(const GraphicsLayerId& layer) noexcept
+{
+    if (layer.isTopLayer()) {
         return Board::ItemZValue::ZValue_CopperTop;
-    } else if (GraphicsLayer::isBottomLayer(name)) {
+    } else if (layer.isBottomLayer()) {
         return Board::ItemZValue::ZValue_CopperBottom;
-    } else if (GraphicsLayer::isCopperLayer(name)) {
+    } else if (layer.isCopperLayer()) {
         // 0.0 => TOP
         // 1.0 => BOTTOM
-        qreal delta = QString(name).remove("in").remove("_cu").toDouble() / 100.0;
+        qreal delta = QString(layer.getName()).remove("in").remove("_cu").toDouble() / 100.0;
         return (Board::ItemZValue::ZValue_CopperTop - delta);
     } else {
         return Board::ItemZValue::ZValue_Default;
     }
 }
 
+BGI_Base::DetailLevel BGI_Base::getDetailLevel(const QPainter* painter,
+                                               const QStyleOptionGraphicsItem* option,
+                                               const QWidget* widget,
+                                               const QRectF& rect) noexcept
+{
+    // sizes in screen pixels
+    static const qreal sMaxBoxSize = 4;
+    static const qreal sMaxSimplifiedSize = 16;
+
+    if (!widget) return DetailLevel::Full;
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const qreal size = qMax(rect.width(), rect.height()) * lod;
+    if (size < sMaxBoxSize) {
+        return DetailLevel::Box;
+    } else if (size < sMaxSimplifiedSize) {
+        return DetailLevel::Simplified;
+    } else {
+        return DetailLevel::Full;
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <librepcb/common/graphics/graphicslayerid.h>
 #include "../board.h"
 
 /*****************************************************************************************
@@ -51,7 +52,34 @@ class BGI_Base : public QGraphicsItem
 
     protected:
 
+        /**
+         * @brief Rendering tiers, depending on the size of an item on the screen
+         */
+        enum class DetailLevel {
+            Full,       ///< everything is drawn
+            Simplified, ///< only simplified outlines, no texts
+            Box,        ///< only a filled box, the item is just a few pixels large
+        };
+
         static qreal getZValueOfCopperLayer(const QString& name) noexcept;
+        static qreal getZValueOfCopperLayer(const GraphicsLayerId& layer) noexcept;
+
+        /**
+         * @brief Determine how detailed an item needs to be painted
+         *
+         * Painting without a widget (e.g. printing or exporting) always returns
+         * DetailLevel::Full since the output must be exact there.
+         *
+         * @param painter   The painter passed to QGraphicsItem::paint()
+         * @param option    The style options passed to QGraphicsItem::paint()
+         * @param widget    The widget passed to QGraphicsItem::paint()
+         * @param rect      The relevant size of the item in scene coordinates
+         *
+         * @return The detail level to paint the item with
+         */
+        static DetailLevel getDetailLevel(const QPainter* painter,
+                                          const QStyleOptionGraphicsItem* option,
+                                          const QWidget* widget, const QRectF& rect) noexcept;
 
 
     private:
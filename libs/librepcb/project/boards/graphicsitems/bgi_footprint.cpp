@@ -73,6 +73,8 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 
     mBoundingRect = QRectF();
     mShape = QPainterPath();
+    mPolygonPaths.clear();
+    mSimplifiedLayers.clear();
 
     // set Z value
     if (mFootprint.getIsMirrored())
@@ -93,11 +95,19 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 
     // polygons
     for (const Polygon& polygon : mLibFootprint.getPolygons()) {
+        QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
+        mPolygonPaths.append(polygonPath);
+        SimplifiedLayer& simplified = mSimplifiedLayers[*polygon.getLayerName()];
+        if (polygon.isFilled()) {
+            simplified.areas.addPath(polygonPath);
+        } else {
+            simplified.outlines.addPath(polygonPath);
+        }
+
         layer = getLayer(*polygon.getLayerName());
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
-        QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
         qreal w = polygon.getLineWidth()->toPx() / 2;
         mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
         if (!polygon.isGrabArea()) continue;
@@ -107,6 +117,22 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
         mShape = mShape.united(polygonPath);
     }
 
+    // circles and holes (only needed for the simplified detail levels)
+    for (const Circle& circle : mLibFootprint.getCircles()) {
+        SimplifiedLayer& simplified = mSimplifiedLayers[*circle.getLayerName()];
+        QPainterPath& path = circle.isFilled() ? simplified.areas : simplified.outlines;
+        path.addEllipse(circle.getCenter().toPxQPointF(), circle.getDiameter()->toPx() / 2,
+                        circle.getDiameter()->toPx() / 2);
+    }
+    for (const Hole& hole : mLibFootprint.getHoles()) {
+        qreal radius = (hole.getDiameter() / 2).toPx();
+        mSimplifiedLayers[GraphicsLayer::sBoardDrillsNpth].areas.addEllipse(
+            hole.getPosition().toPxQPointF(), radius, radius);
+    }
+    for (SimplifiedLayer& simplified : mSimplifiedLayers) {
+        simplified.areas.setFillRule(Qt::WindingFill);
+    }
+
     if (!mShape.isEmpty())
         mShape.setFillRule(Qt::WindingFill);
 
@@ -121,15 +147,21 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
 
 void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
-    Q_UNUSED(widget);
-
     const GraphicsLayer* layer = 0;
     const bool selected = mFootprint.isSelected();
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
 
+    const DetailLevel detail = getDetailLevel(painter, option, widget, mBoundingRect);
+    if (detail != DetailLevel::Full) {
+        paintSimplified(painter, detail == DetailLevel::Box, selected);
+        return;
+    }
+
     // draw all polygons
+    int polygonIndex = -1;
     for (const Polygon& polygon : mLibFootprint.getPolygons()) {
+        ++polygonIndex;
+
         // get layer
         layer = getLayer(*polygon.getLayerName());
         if (!layer) continue;
@@ -158,7 +190,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         }
 
         // draw polygon
-        painter->drawPath(polygon.getPath().toQPainterPathPx());
+        painter->drawPath(mPolygonPaths.at(polygonIndex));
     }
 
     // draw all circles
@@ -241,10 +273,35 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_Footprint::getLayer(QString name) const noexcept
+void BGI_Footprint::paintSimplified(QPainter* painter, bool box, bool selected) noexcept
+{
+    for (auto it = mSimplifiedLayers.constBegin(); it != mSimplifiedLayers.constEnd(); ++it) {
+        const GraphicsLayer* layer = getLayer(it.key());
+        if (!layer) continue;
+        if (!layer->isVisible()) continue;
+
+        const QColor color = layer->getColor(selected);
+        if (box) {
+            // the footprint is only a few pixels large, so a filled box is sufficient
+            QRectF rect = it.value().outlines.boundingRect() | it.value().areas.boundingRect();
+            painter->fillRect(rect, color);
+        } else {
+            // cosmetic pens and merged paths are much cheaper than the exact primitives
+            painter->setPen(QPen(color, 0));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawPath(it.value().outlines);
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(QBrush(color, Qt::SolidPattern));
+            painter->drawPath(it.value().areas);
+        }
+    }
+}
+
+GraphicsLayer* BGI_Footprint::getLayer(const QString& name) const noexcept
 {
-    if (mFootprint.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mFootprint.getDeviceInstance().getBoard().getLayerStack().getLayer(name);
+    GraphicsLayerId layer(name);
+    if (mFootprint.getIsMirrored()) layer = layer.getMirrored();
+    return mFootprint.getDeviceInstance().getBoard().getLayerStack().getLayer(layer);
 }
 
 /*****************************************************************************************
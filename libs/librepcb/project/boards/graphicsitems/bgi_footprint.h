@@ -81,7 +81,8 @@ class BGI_Footprint final : public BGI_Base
         BGI_Footprint& operator=(const BGI_Footprint& rhs) = delete;
 
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        void paintSimplified(QPainter* painter, bool box, bool selected) noexcept;
+        GraphicsLayer* getLayer(const QString& name) const noexcept;
 
 
         // General Attributes
@@ -91,6 +92,14 @@ class BGI_Footprint final : public BGI_Base
         // Cached Attributes
         QRectF mBoundingRect;
         QPainterPath mShape;
+        QVector<QPainterPath> mPolygonPaths; ///< same order as the library polygons
+
+        /// All primitives of a layer, merged for the simplified detail levels
+        struct SimplifiedLayer {
+            QPainterPath outlines;  ///< drawn with a cosmetic pen
+            QPainterPath areas;     ///< drawn filled
+        };
+        QMap<QString, SimplifiedLayer> mSimplifiedLayers; ///< key: not mirrored layer name
 };
 
 /*****************************************************************************************
@@ -128,14 +128,20 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
 
 void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
-    Q_UNUSED(widget);
     //const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
-    //const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const DetailLevel detail = getDetailLevel(painter, option, widget, mBoundingRect);
 
     const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
     bool highlight = mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+    if (detail == DetailLevel::Box) {
+        // the pad is only a few pixels large, so draw just a box of the copper
+        if (mPadLayer && mPadLayer->isVisible()) {
+            painter->fillRect(mCopper.boundingRect(), mPadLayer->getColor(highlight));
+        }
+        return;
+    }
+
     if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
         // draw bottom cream mask
         painter->setPen(Qt::NoPen);
@@ -155,10 +161,12 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
         painter->setPen(Qt::NoPen);
         painter->setBrush(mPadLayer->getColor(highlight));
         painter->drawPath(mCopper);
-        // draw pad text
-        painter->setFont(mFont);
-        painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-        painter->drawText(mShape.boundingRect(), Qt::AlignCenter, mPad.getDisplayText());
+        // draw pad text (not readable anyway if the pad is small on the screen)
+        if (detail == DetailLevel::Full) {
+            painter->setFont(mFont);
+            painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+            painter->drawText(mShape.boundingRect(), Qt::AlignCenter, mPad.getDisplayText());
+        }
     }
 
     if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
@@ -192,10 +200,11 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_FootprintPad::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_FootprintPad::getLayer(const QString& name) const noexcept
 {
-    if (mPad.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mPad.getFootprint().getDeviceInstance().getBoard().getLayerStack().getLayer(name);
+    GraphicsLayerId layer(name);
+    if (mPad.getIsMirrored()) layer = layer.getMirrored();
+    return mPad.getFootprint().getDeviceInstance().getBoard().getLayerStack().getLayer(layer);
 }
 
 /*****************************************************************************************
@@ -81,7 +81,7 @@ class BGI_FootprintPad final : public BGI_Base
         BGI_FootprintPad& operator=(const BGI_FootprintPad& rhs) = delete;
 
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const QString& name) const noexcept;
 
 
         // General Attributes
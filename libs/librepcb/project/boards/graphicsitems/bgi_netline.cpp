@@ -71,7 +71,7 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
     prepareGeometryChange();
 
     // set Z value
-    setZValue(getZValueOfCopperLayer(mNetLine.getLayer().getName()));
+    setZValue(getZValueOfCopperLayer(mNetLine.getLayer().getId()));
 
     mLayer = &mNetLine.getLayer();
     Q_ASSERT(mLayer);
@@ -98,16 +98,19 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
 
 void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
-    Q_UNUSED(widget);
-
     bool highlight = mNetLine.isSelected() || mNetLine.getNetSignalOfNetSegment().isHighlighted();
 
-    // draw line
+    // draw line (as a cosmetic line if it is only a few pixels wide on the screen, which
+    // is much faster than drawing a wide line with round caps)
     if (mLayer->isVisible())
     {
-        QPen pen(mLayer->getColor(highlight), mNetLine.getWidth()->toPx(), Qt::SolidLine, Qt::RoundCap);
-        painter->setPen(pen);
+        const qreal width = mNetLine.getWidth()->toPx();
+        const DetailLevel detail = getDetailLevel(painter, option, widget, QRectF(0, 0, width, width));
+        if (detail == DetailLevel::Box) {
+            painter->setPen(QPen(mLayer->getColor(highlight), 0));
+        } else {
+            painter->setPen(QPen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap));
+        }
         painter->drawLine(mLineF);
     }
 
@@ -0,0 +1,149 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bgi_netlinebatch.h"
+#include "../items/bi_netline.h"
+#include "../items/bi_netpoint.h"
+#include "../../circuit/netsignal.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BGI_NetLineBatch::BGI_NetLineBatch(const GraphicsLayer& layer, const PositiveLength& width) noexcept :
+    BGI_Base(), mLayer(layer), mWidth(width), mIndex(Length::fromMm(5).toPx())
+{
+    // the exposed rect is needed to paint only the affected lines
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption, true);
+    setZValue(getZValueOfCopperLayer(mLayer.getId()));
+    setVisible(mLayer.isVisible());
+
+    mLayerConnection = QObject::connect(&mLayer, &GraphicsLayer::attributesChanged,
+                                        [this](){layerAttributesChanged();});
+}
+
+BGI_NetLineBatch::~BGI_NetLineBatch() noexcept
+{
+    Q_ASSERT(mLines.isEmpty());
+    QObject::disconnect(mLayerConnection);
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BGI_NetLineBatch::addNetLine(const BI_NetLine& netline) noexcept
+{
+    Q_ASSERT(!mLines.contains(&netline));
+    mLines.insert(&netline, QLineF()); // the line is set by updateNetLine()
+    updateNetLine(netline);
+}
+
+void BGI_NetLineBatch::updateNetLine(const BI_NetLine& netline) noexcept
+{
+    Q_ASSERT(mLines.contains(&netline));
+    QLineF line(netline.getStartPoint().getPosition().toPxQPointF(),
+                netline.getEndPoint().getPosition().toPxQPointF());
+    QLineF oldLine = mLines.value(&netline);
+    QRectF rect = getLineRect(line);
+    if (!mBoundingRect.contains(rect)) {
+        prepareGeometryChange();
+        mBoundingRect = mBoundingRect.united(rect);
+    }
+    mLines.insert(&netline, line);
+    mIndex.insert(&netline, rect);
+    if (!oldLine.isNull()) update(getLineRect(oldLine));
+    update(rect);
+}
+
+void BGI_NetLineBatch::removeNetLine(const BI_NetLine& netline) noexcept
+{
+    Q_ASSERT(mLines.contains(&netline));
+    QLineF line = mLines.take(&netline);
+    mIndex.remove(&netline);
+    update(getLineRect(line));
+}
+
+/*****************************************************************************************
+ *  Inherited from QGraphicsItem
+ ****************************************************************************************/
+
+void BGI_NetLineBatch::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    if (!mLayer.isVisible()) return;
+
+    // collect all exposed lines, grouped by their highlight state
+    QVector<QLineF> lines;
+    QVector<QLineF> highlightedLines;
+    foreach (const BI_NetLine* netline, getNetLinesInRect(option->exposedRect)) {
+        if (netline->isSelected() || netline->getNetSignalOfNetSegment().isHighlighted()) {
+            highlightedLines.append(mLines.value(netline));
+        } else {
+            lines.append(mLines.value(netline));
+        }
+    }
+
+    // draw them (as cosmetic lines if they are only a few pixels wide on the screen)
+    const qreal width = mWidth->toPx();
+    const DetailLevel detail = getDetailLevel(painter, option, widget, QRectF(0, 0, width, width));
+    QPen pen(mLayer.getColor(false), width, Qt::SolidLine, Qt::RoundCap);
+    if (detail == DetailLevel::Box) {
+        pen.setWidth(0);
+    }
+    painter->setPen(pen);
+    painter->drawLines(lines);
+    pen.setColor(mLayer.getColor(true));
+    painter->setPen(pen);
+    painter->drawLines(highlightedLines);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BGI_NetLineBatch::layerAttributesChanged() noexcept
+{
+    setVisible(mLayer.isVisible());
+    update(); // the color of all lines may have changed
+}
+
+QRectF BGI_NetLineBatch::getLineRect(const QLineF& line) const noexcept
+{
+    const qreal margin = mWidth->toPx() / 2;
+    return QRectF(line.p1(), line.p2()).normalized().adjusted(-margin, -margin, margin, margin);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
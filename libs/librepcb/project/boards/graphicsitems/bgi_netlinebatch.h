@@ -0,0 +1,118 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BGI_NETLINEBATCH_H
+#define LIBREPCB_PROJECT_BGI_NETLINEBATCH_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bgi_base.h"
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/utils/spatialgridindex.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class GraphicsLayer;
+
+namespace project {
+
+class BI_NetLine;
+
+/*****************************************************************************************
+ *  Class BGI_NetLineBatch
+ ****************************************************************************************/
+
+/**
+ * @brief A graphics item which draws all net lines of one layer and width at once
+ *
+ * On dense boards, one librepcb::project::BGI_NetLine per net line results in a huge
+ * number of items in the graphics scene, which makes both indexing and painting slow.
+ * If net line batching is enabled (see librepcb::project::Board), the net lines are
+ * instead registered in a batch item of their layer and width. The batch keeps the
+ * lines in a librepcb::SpatialGridIndex, so only the lines within the exposed area
+ * are painted, all with a single QPainter::drawLines() call (one per highlight state).
+ *
+ * Selecting and highlighting is still done on the net lines themselves, they just
+ * call #updateNetLine() to repaint the affected area of the batch. Changes of the layer
+ * attributes (e.g. visibility or color) repaint the whole batch.
+ */
+class BGI_NetLineBatch final : public BGI_Base
+{
+    public:
+
+        // Constructors / Destructor
+        BGI_NetLineBatch(const GraphicsLayer& layer, const PositiveLength& width) noexcept;
+        ~BGI_NetLineBatch() noexcept;
+
+        // Getters
+        const GraphicsLayer& getLayer() const noexcept {return mLayer;}
+        const PositiveLength& getWidth() const noexcept {return mWidth;}
+        int getNetLineCount() const noexcept {return mLines.count();}
+        QList<const BI_NetLine*> getNetLinesInRect(const QRectF& rect) const noexcept {
+            return mIndex.find(rect);
+        }
+
+        // General Methods
+        void addNetLine(const BI_NetLine& netline) noexcept;
+        void updateNetLine(const BI_NetLine& netline) noexcept;
+        void removeNetLine(const BI_NetLine& netline) noexcept;
+
+        // Inherited from QGraphicsItem
+        QRectF boundingRect() const noexcept {return mBoundingRect;}
+        QPainterPath shape() const noexcept {return QPainterPath();} // not grabbable
+        void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0);
+
+
+    private:
+
+        // make some methods inaccessible...
+        BGI_NetLineBatch() = delete;
+        BGI_NetLineBatch(const BGI_NetLineBatch& other) = delete;
+        BGI_NetLineBatch& operator=(const BGI_NetLineBatch& rhs) = delete;
+
+        // Private Methods
+        void layerAttributesChanged() noexcept;
+        QRectF getLineRect(const QLineF& line) const noexcept;
+
+
+        // Attributes
+        const GraphicsLayer& mLayer;
+        PositiveLength mWidth;
+        QMetaObject::Connection mLayerConnection;
+
+        // Cached Attributes
+        QHash<const BI_NetLine*, QLineF> mLines;
+        SpatialGridIndex<const BI_NetLine*> mIndex;
+        QRectF mBoundingRect; ///< only grows, to avoid updating the whole scene index
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BGI_NETLINEBATCH_H
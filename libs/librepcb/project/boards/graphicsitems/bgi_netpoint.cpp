@@ -70,7 +70,7 @@ void BGI_NetPoint::updateCacheAndRepaint() noexcept
     prepareGeometryChange();
 
     // set Z value
-    setZValue(getZValueOfCopperLayer(mNetPoint.getLayer().getName()));
+    setZValue(getZValueOfCopperLayer(mNetPoint.getLayer().getId()));
 
     qreal radius = mNetPoint.getMaxLineWidth()->toPx() / 2;
     mBoundingRect = QRectF(-radius, -radius, 2*radius, 2*radius);
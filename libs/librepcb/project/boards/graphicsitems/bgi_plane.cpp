@@ -132,10 +132,11 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_Plane::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_Plane::getLayer(const QString& name) const noexcept
 {
-    if (mPlane.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mPlane.getBoard().getLayerStack().getLayer(name);
+    GraphicsLayerId layer(name);
+    if (mPlane.getIsMirrored()) layer = layer.getMirrored();
+    return mPlane.getBoard().getLayerStack().getLayer(layer);
 }
 
 /*****************************************************************************************
@@ -78,7 +78,7 @@ class BGI_Plane final : public BGI_Base
         BGI_Plane& operator=(const BGI_Plane& rhs) = delete;
 
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const QString& name) const noexcept;
 
         // General Attributes
         BI_Plane& mPlane;
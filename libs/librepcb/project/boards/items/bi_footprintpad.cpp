@@ -107,11 +107,12 @@ QString BI_FootprintPad::getLayerName() const noexcept
 
 bool BI_FootprintPad::isOnLayer(const QString& layerName) const noexcept
 {
-    if (getIsMirrored()) {
-        return mFootprintPad->isOnLayer(GraphicsLayer::getMirroredLayerName(layerName));
-    } else {
-        return mFootprintPad->isOnLayer(layerName);
-    }
+    return isOnLayer(GraphicsLayerId(layerName));
+}
+
+bool BI_FootprintPad::isOnLayer(const GraphicsLayerId& layer) const noexcept
+{
+    return mFootprintPad->isOnLayer(getIsMirrored() ? layer.getMirrored() : layer);
 }
 
 NetSignal* BI_FootprintPad::getCompSigInstNetSignal() const noexcept
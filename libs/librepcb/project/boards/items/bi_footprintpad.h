@@ -27,6 +27,7 @@
 #include "bi_base.h"
 #include "../graphicsitems/bgi_footprintpad.h"
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayerid.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -73,6 +74,7 @@ class BI_FootprintPad final : public BI_Base
         BI_NetPoint* getNetPointOfLayer(const QString& layerName) const noexcept {return mRegisteredNetPoints.value(layerName, nullptr);}
         QString getLayerName() const noexcept;
         bool isOnLayer(const QString& layerName) const noexcept;
+        bool isOnLayer(const GraphicsLayerId& layer) const noexcept;
         const library::FootprintPad& getLibPad() const noexcept {return *mFootprintPad;}
         ComponentSignalInstance* getComponentSignalInstance() const noexcept {return mComponentSignalInstance;}
         NetSignal* getCompSigInstNetSignal() const noexcept;
@@ -29,6 +29,7 @@
 #include "../../circuit/netsignal.h"
 #include "bi_footprint.h"
 #include "bi_footprintpad.h"
+#include "../graphicsitems/bgi_netlinebatch.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/scopeguard.h>
 
@@ -43,7 +44,8 @@ namespace project {
  ****************************************************************************************/
 
 BI_NetLine::BI_NetLine(const BI_NetLine& other, BI_NetPoint& startPoint, BI_NetPoint& endPoint) :
-    BI_Base(startPoint.getBoard()), mPosition(other.mPosition), mUuid(Uuid::createRandom()),
+    BI_Base(startPoint.getBoard()), mBatch(nullptr), mPosition(other.mPosition),
+    mUuid(Uuid::createRandom()),
     mStartPoint(&startPoint), mEndPoint(&endPoint), mWidth(other.mWidth)
 {
     init();
@@ -51,6 +53,7 @@ BI_NetLine::BI_NetLine(const BI_NetLine& other, BI_NetPoint& startPoint, BI_NetP
 
 BI_NetLine::BI_NetLine(BI_NetSegment& segment, const SExpression& node) :
     BI_Base(segment.getBoard()),
+    mBatch(nullptr),
     mPosition(),
     mUuid(node.getChildByIndex(0).getValue<Uuid>()),
     mStartPoint(nullptr),
@@ -77,7 +80,7 @@ BI_NetLine::BI_NetLine(BI_NetSegment& segment, const SExpression& node) :
 }
 
 BI_NetLine::BI_NetLine(BI_NetPoint& startPoint, BI_NetPoint& endPoint, const PositiveLength& width) :
-    BI_Base(startPoint.getBoard()), mPosition(), mUuid(Uuid::createRandom()),
+    BI_Base(startPoint.getBoard()), mBatch(nullptr), mPosition(), mUuid(Uuid::createRandom()),
     mStartPoint(&startPoint), mEndPoint(&endPoint), mWidth(width)
 {
     init();
@@ -111,6 +114,7 @@ void BI_NetLine::init()
 
 BI_NetLine::~BI_NetLine() noexcept
 {
+    if (mBatch) mBatch->removeNetLine(*this);
     mGraphicsItem.reset();
 }
 
@@ -182,6 +186,7 @@ void BI_NetLine::setWidth(const PositiveLength& width) noexcept
     if (width != mWidth) {
         mWidth = width;
         mGraphicsItem->updateCacheAndRepaint();
+        updateBatch(); // the width determines the batch
     }
 }
 
@@ -204,8 +209,9 @@ void BI_NetLine::addToBoard()
 
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                               &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
-    BI_Base::addToBoard(mGraphicsItem.data());
+                                              [this](){mGraphicsItem->update(); updateBatch();});
+    BI_Base::addToBoard(nullptr); // the graphics item is added by updateBatch()
+    updateBatch();
     sg.dismiss();
 }
 
@@ -223,7 +229,8 @@ void BI_NetLine::removeFromBoard()
     mEndPoint->unregisterNetLine(*this); // can throw
 
     disconnect(mHighlightChangedConnection);
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    BI_Base::removeFromBoard(nullptr); // the graphics item is removed by updateBatch()
+    updateBatch();
     sg.dismiss();
 }
 
@@ -231,6 +238,31 @@ void BI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
     mGraphicsItem->updateCacheAndRepaint();
+    updateBatch();
+}
+
+void BI_NetLine::updateBatch() noexcept
+{
+    // if batching is enabled, the line is drawn by the batch of its layer and width,
+    // otherwise by its own graphics item
+    BGI_NetLineBatch* batch = nullptr;
+    if (isAddedToBoard() && mBoard.isNetLineBatchingEnabled()) {
+        batch = &mBoard.getNetLineBatch(getLayer(), mWidth);
+    }
+    if (batch != mBatch) {
+        if (mBatch) mBatch->removeNetLine(*this);
+        mBatch = batch;
+        if (mBatch) mBatch->addNetLine(*this);
+    } else if (mBatch) {
+        mBatch->updateNetLine(*this);
+    }
+
+    bool addToScene = isAddedToBoard() && (!mBatch);
+    if (addToScene && (!mGraphicsItem->scene())) {
+        mBoard.getGraphicsScene().addItem(*mGraphicsItem);
+    } else if ((!addToScene) && mGraphicsItem->scene()) {
+        mBoard.getGraphicsScene().removeItem(*mGraphicsItem);
+    }
 }
 
 void BI_NetLine::serialize(SExpression& root) const
@@ -261,6 +293,7 @@ void BI_NetLine::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
     mGraphicsItem->update();
+    updateBatch();
 }
 
 /*****************************************************************************************
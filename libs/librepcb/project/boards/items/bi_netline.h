@@ -42,6 +42,7 @@ namespace project {
 class NetSignal;
 class BI_NetPoint;
 class BI_NetSegment;
+class BGI_NetLineBatch;
 
 /*****************************************************************************************
  *  Class BI_NetLine
@@ -86,6 +87,7 @@ class BI_NetLine final : public BI_Base, public SerializableObject
         void addToBoard() override;
         void removeFromBoard() override;
         void updateLine() noexcept;
+        void updateBatch() noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -110,6 +112,7 @@ class BI_NetLine final : public BI_Base, public SerializableObject
 
         // General
         QScopedPointer<BGI_NetLine> mGraphicsItem;
+        BGI_NetLineBatch* mBatch; ///< the batch which draws this line (if any)
         Point mPosition; ///< the center of startpoint and endpoint
         QMetaObject::Connection mHighlightChangedConnection;
 
@@ -147,7 +147,7 @@ void BI_NetPoint::init()
             .arg(mUuid.toStr()).arg(mLayer->getName()));
     }
     if (mFootprintPad) {
-        if (!mFootprintPad->isOnLayer(mLayer->getName())) {
+        if (!mFootprintPad->isOnLayer(mLayer->getId())) {
             throw RuntimeError(__FILE__, __LINE__,
                 QString(tr("The layer of netpoint \"%1\" is invalid (%2)."))
                 .arg(mUuid.toStr()).arg(mLayer->getName()));
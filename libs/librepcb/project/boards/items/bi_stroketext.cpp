@@ -178,7 +178,7 @@ void BI_StrokeText::setSelected(bool selected) noexcept
 
 void BI_StrokeText::boardAttributesChanged()
 {
-    mText->updatePaths();
+    mText->updateSubstitutedText();
 }
 
 /*****************************************************************************************
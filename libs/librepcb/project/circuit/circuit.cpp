@@ -44,7 +44,8 @@ namespace project {
 
 Circuit::Circuit(Project& project, bool restore, bool readOnly, bool create) :
     QObject(&project), mProject(project),
-    mFilepath(project.getPath().getPathTo("circuit/circuit.lp")), mFile(nullptr)
+    mFilepath(project.getPath().getPathTo("circuit/circuit.lp")), mFile(nullptr),
+    mLowestFreeAutoNetSignalNumber(1)
 {
     qDebug() << "load circuit...";
     Q_ASSERT(!(create && (restore || readOnly)));
@@ -192,11 +193,10 @@ void Circuit::setNetClassName(NetClass& netclass, const ElementName& newName)
 
 QString Circuit::generateAutoNetSignalName() const noexcept
 {
-    QString name;
-    int i = 1;
-    do {
-        name = QString("N%1").arg(i++);
-    } while (getNetSignalByName(name));
+    QString name = QString("N%1").arg(mLowestFreeAutoNetSignalNumber);
+    while (mNetSignalsByName.contains(name)) {
+        name = QString("N%1").arg(++mLowestFreeAutoNetSignalNumber);
+    }
     return name;
 }
 
@@ -207,12 +207,7 @@ NetSignal* Circuit::getNetSignalByUuid(const Uuid& uuid) const noexcept
 
 NetSignal* Circuit::getNetSignalByName(const QString& name) const noexcept
 {
-    foreach (NetSignal* netsignal, mNetSignals) {
-        if (netsignal->getName() == name) {
-            return netsignal;
-        }
-    }
-    return nullptr;
+    return mNetSignalsByName.value(name, nullptr);
 }
 
 NetSignal* Circuit:: getNetSignalWithMostElements() const noexcept
@@ -246,6 +241,7 @@ void Circuit::addNetSignal(NetSignal& netsignal)
     // add netsignal to circuit
     netsignal.addToCircuit(); // can throw
     mNetSignals.insert(netsignal.getUuid(), &netsignal);
+    addNetSignalName(netsignal);
     emit netSignalAdded(netsignal);
 }
 
@@ -258,6 +254,7 @@ void Circuit::removeNetSignal(NetSignal& netsignal)
     // remove netsignal from circuit
     netsignal.removeFromCircuit(); // can throw
     mNetSignals.remove(netsignal.getUuid());
+    removeNetSignalName(netsignal);
     emit netSignalRemoved(netsignal);
 }
 
@@ -274,7 +271,9 @@ void Circuit::setNetSignalName(NetSignal& netsignal, const CircuitIdentifier& ne
             QString(tr("There is already a net signal with the name \"%1\"!")).arg(*newName));
     }
     // apply the new name
+    removeNetSignalName(netsignal);
     netsignal.setName(newName, isAutoName); // can throw
+    addNetSignalName(netsignal);
 }
 
 void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept
@@ -401,6 +400,37 @@ void Circuit::serialize(SExpression& root) const
     root.appendLineBreak();
 }
 
+void Circuit::addNetSignalName(NetSignal& netsignal) noexcept
+{
+    Q_ASSERT(!mNetSignalsByName.contains(*netsignal.getName()));
+    mNetSignalsByName.insert(*netsignal.getName(), &netsignal);
+}
+
+void Circuit::removeNetSignalName(NetSignal& netsignal) noexcept
+{
+    Q_ASSERT(mNetSignalsByName.value(*netsignal.getName()) == &netsignal);
+    mNetSignalsByName.remove(*netsignal.getName());
+
+    // the name is free again, so it can be used for the next auto net signal
+    int number = getAutoNetSignalNumber(*netsignal.getName());
+    if ((number > 0) && (number < mLowestFreeAutoNetSignalNumber)) {
+        mLowestFreeAutoNetSignalNumber = number;
+    }
+}
+
+int Circuit::getAutoNetSignalNumber(const QString& name) noexcept
+{
+    // only names like generated by generateAutoNetSignalName() are relevant
+    if (name.startsWith('N')) {
+        bool ok = false;
+        int number = name.mid(1).toInt(&ok);
+        if (ok && (number > 0) && (QString("N%1").arg(number) == name)) {
+            return number;
+        }
+    }
+    return -1;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
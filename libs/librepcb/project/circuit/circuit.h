@@ -137,6 +137,9 @@ class Circuit final : public QObject, public SerializableObject
     private:
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
+        void addNetSignalName(NetSignal& netsignal) noexcept;
+        void removeNetSignalName(NetSignal& netsignal) noexcept;
+        static int getAutoNetSignalNumber(const QString& name) noexcept;
 
 
         // General
@@ -149,6 +152,17 @@ class Circuit final : public QObject, public SerializableObject
         QMap<Uuid, NetClass*> mNetClasses;
         QMap<Uuid, NetSignal*> mNetSignals;
         QMap<Uuid, ComponentInstance*> mComponentInstances;
+
+        /// All net signals of #mNetSignals, indexed by their name
+        QHash<QString, NetSignal*> mNetSignalsByName;
+
+        /**
+         * @brief Lower bound of the lowest free auto net signal number ("N1", "N2", ...)
+         *
+         * All numbers below this value are in use. Used to make
+         * #generateAutoNetSignalName() fast even with thousands of nets.
+         */
+        mutable int mLowestFreeAutoNetSignalNumber;
 };
 
 /*****************************************************************************************
@@ -31,6 +31,7 @@
 #include "componentsignalinstance.h"
 #include <librepcb/library/cmp/component.h>
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../schematics/items/si_symbol.h"
 #include "../boards/items/bi_device.h"
 
@@ -121,16 +122,19 @@ void ComponentInstance::init()
         "UnplacedRequiredSymbols", ErcMsg::ErcMsgType_t::SchematicError));
     mErcMsgUnplacedOptionalSymbols.reset(new ErcMsg(mCircuit.getProject(), *this, mUuid.toStr(),
         "UnplacedOptionalSymbols", ErcMsg::ErcMsgType_t::SchematicWarning));
-    updateErcMessages();
 
     // emit the "attributesChanged" signal when the project has emited it
     connect(&mCircuit.getProject(), &Project::attributesChanged, this, &ComponentInstance::attributesChanged);
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
+
+    // must be the last statement since the destructor won't be called on exceptions
+    updateErcMessages();
 }
 
 ComponentInstance::~ComponentInstance() noexcept
 {
+    mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
 
@@ -389,6 +393,11 @@ bool ComponentInstance::checkAttributesValidity() const noexcept
 }
 
 void ComponentInstance::updateErcMessages() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
+void ComponentInstance::evaluateErcMessages() noexcept
 {
     int required = getUnplacedRequiredSymbolsCount();
     int optional = getUnplacedOptionalSymbolsCount();
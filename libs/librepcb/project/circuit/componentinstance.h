@@ -158,6 +158,7 @@ class ComponentInstance : public QObject, public AttributeProvider,
         void init();
         bool checkAttributesValidity() const noexcept;
         void updateErcMessages() noexcept;
+        void evaluateErcMessages() noexcept override;
         const QStringList& getLocaleOrder() const noexcept;
 
 
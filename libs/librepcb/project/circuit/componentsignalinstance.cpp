@@ -29,6 +29,7 @@
 #include "netsignal.h"
 #include <librepcb/library/cmp/component.h>
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
 #include "../settings/projectsettings.h"
 #include "../schematics/items/si_symbolpin.h"
@@ -82,7 +83,6 @@ void ComponentSignalInstance::init()
     mErcMsgForcedNetSignalNameConflict.reset(new ErcMsg(mCircuit.getProject(), *this,
         QString("%1/%2").arg(mComponentInstance.getUuid().toStr()).arg(mComponentSignal->getUuid().toStr()),
         "ForcedNetSignalNameConflict", ErcMsg::ErcMsgType_t::SchematicError, QString()));
-    updateErcMessages();
 
     // register to component attributes changed
     connect(&mComponentInstance, &ComponentInstance::attributesChanged,
@@ -95,10 +95,14 @@ void ComponentSignalInstance::init()
     }
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
+
+    // must be the last statement since the destructor won't be called on exceptions
+    updateErcMessages();
 }
 
 ComponentSignalInstance::~ComponentSignalInstance() noexcept
 {
+    mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
     Q_ASSERT(!arePinsOrPadsUsed());
@@ -281,6 +285,11 @@ void ComponentSignalInstance::netSignalNameChanged(const CircuitIdentifier& newN
 }
 
 void ComponentSignalInstance::updateErcMessages() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
+void ComponentSignalInstance::evaluateErcMessages() noexcept
 {
     mErcMsgUnconnectedRequiredSignal->setMsg(
         QString(tr("Unconnected component signal: \"%1\" from \"%2\""))
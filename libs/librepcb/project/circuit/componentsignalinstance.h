@@ -131,6 +131,7 @@ class ComponentSignalInstance final : public QObject, public IF_ErcMsgProvider,
 
         void init();
         bool checkAttributesValidity() const noexcept;
+        void evaluateErcMessages() noexcept override;
 
 
         // General
@@ -26,6 +26,8 @@
 #include "netsignal.h"
 #include "circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -52,6 +54,7 @@ NetClass::NetClass(Circuit& circuit, const ElementName& name) :
 
 NetClass::~NetClass() noexcept
 {
+    mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
 }
@@ -127,6 +130,11 @@ void NetClass::serialize(SExpression& root) const
  ****************************************************************************************/
 
 void NetClass::updateErcMessages() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
+void NetClass::evaluateErcMessages() noexcept
 {
     if (mIsAddedToCircuit && (!isUsed())) {
         if (!mErcMsgUnusedNetClass) {
@@ -87,6 +87,7 @@ class NetClass final : public QObject, public IF_ErcMsgProvider,
 
     private:
         void updateErcMessages() noexcept;
+        void evaluateErcMessages() noexcept override;
 
 
         // General
@@ -26,6 +26,8 @@
 #include <librepcb/common/exceptions.h>
 #include "circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include "componentsignalinstance.h"
 #include "../schematics/items/si_netsegment.h"
 #include "../boards/items/bi_netsegment.h"
@@ -69,6 +71,7 @@ NetSignal::NetSignal(Circuit& circuit, NetClass& netclass, const CircuitIdentifi
 
 NetSignal::~NetSignal() noexcept
 {
+    mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
 }
@@ -255,6 +258,11 @@ bool NetSignal::checkAttributesValidity() const noexcept
 }
 
 void NetSignal::updateErcMessages() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
+void NetSignal::evaluateErcMessages() noexcept
 {
     if (mIsAddedToCircuit && (!isUsed())) {
         if (!mErcMsgUnusedNetSignal) {
@@ -118,6 +118,7 @@ class NetSignal final : public QObject, public IF_ErcMsgProvider, public Seriali
     private:
         bool checkAttributesValidity() const noexcept;
         void updateErcMessages() noexcept;
+        void evaluateErcMessages() noexcept override;
 
 
         // General
@@ -40,8 +40,13 @@ namespace project {
 
 ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool create) :
     QObject(&project), mProject(project),
-    mFilepath(project.getPath().getPathTo("circuit/erc.lp")), mFile(nullptr)
+    mFilepath(project.getPath().getPathTo("circuit/erc.lp")), mFile(nullptr),
+    mItemsModified(false)
 {
+    mProcessTimer.setSingleShot(true);
+    mProcessTimer.setInterval(0);
+    connect(&mProcessTimer, &QTimer::timeout, this, &ErcMsgList::processScheduledUpdates);
+
     // try to create/open the file "erc.lp"
     if (create) {
         mFile.reset(SmartSExprFile::create(mFilepath));
@@ -53,6 +58,7 @@ ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool creat
 ErcMsgList::~ErcMsgList() noexcept
 {
     Q_ASSERT(mItems.isEmpty());
+    Q_ASSERT(mScheduledProviders.isEmpty());
 }
 
 /*****************************************************************************************
@@ -66,6 +72,7 @@ void ErcMsgList::add(ErcMsg* ercMsg) noexcept
     Q_ASSERT(!ercMsg->isIgnored());
     mItems.append(ercMsg);
     emit ercMsgAdded(ercMsg);
+    itemsModified();
 }
 
 void ErcMsgList::remove(ErcMsg* ercMsg) noexcept
@@ -75,6 +82,7 @@ void ErcMsgList::remove(ErcMsg* ercMsg) noexcept
     Q_ASSERT(!ercMsg->isIgnored());
     mItems.removeOne(ercMsg);
     emit ercMsgRemoved(ercMsg);
+    itemsModified();
 }
 
 void ErcMsgList::update(ErcMsg* ercMsg) noexcept
@@ -83,12 +91,51 @@ void ErcMsgList::update(ErcMsg* ercMsg) noexcept
     Q_ASSERT(mItems.contains(ercMsg));
     Q_ASSERT(ercMsg->isVisible());
     emit ercMsgChanged(ercMsg);
+    itemsModified();
+}
+
+void ErcMsgList::scheduleUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    if (!mScheduledProvidersSet.contains(&provider)) {
+        mScheduledProviders.append(&provider);
+        mScheduledProvidersSet.insert(&provider);
+    }
+    if (!mProcessTimer.isActive()) {
+        mProcessTimer.start();
+    }
+}
+
+void ErcMsgList::cancelUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    if (mScheduledProvidersSet.remove(&provider)) {
+        mScheduledProviders.removeOne(&provider);
+    }
+}
+
+void ErcMsgList::processScheduledUpdates() noexcept
+{
+    mProcessTimer.stop();
+
+    // evaluating a provider may schedule other providers, so loop until none are left
+    while (!mScheduledProviders.isEmpty()) {
+        IF_ErcMsgProvider* provider = mScheduledProviders.takeFirst();
+        mScheduledProvidersSet.remove(provider);
+        provider->evaluateErcMessages();
+    }
+
+    if (mItemsModified) {
+        mItemsModified = false;
+        emit ercMsgsChanged();
+    }
 }
 
 void ErcMsgList::restoreIgnoreState()
 {
     if (mFile->isCreated()) return; // the file does not yet exist
 
+    // make sure all messages exist before restoring their state
+    processScheduledUpdates();
+
     SExpression root = mFile->parseFileAndBuildDomTree();
 
     // reset all ignore attributes
@@ -112,6 +159,9 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
+    // make sure messages of recently modified providers are up to date
+    processScheduledUpdates();
+
     // Save "circuit/erc.lp"
     try
     {
@@ -131,6 +181,14 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
  *  Private Methods
  ****************************************************************************************/
 
+void ErcMsgList::itemsModified() noexcept
+{
+    mItemsModified = true;
+    if (!mProcessTimer.isActive()) {
+        mProcessTimer.start();
+    }
+}
+
 void ErcMsgList::serialize(SExpression& root) const
 {
     foreach (ErcMsg* ercMsg, mItems) {
@@ -39,6 +39,7 @@ namespace project {
 
 class Project;
 class ErcMsg;
+class IF_ErcMsgProvider;
 
 /*****************************************************************************************
  *  Class ErcMsgList
@@ -66,6 +67,29 @@ class ErcMsgList final : public QObject, public SerializableObject
         void add(ErcMsg* ercMsg) noexcept;
         void remove(ErcMsg* ercMsg) noexcept;
         void update(ErcMsg* ercMsg) noexcept;
+
+        /**
+         * @brief Schedule the re-evaluation of the ERC messages of a provider
+         *
+         * The evaluation is deferred until the event loop is entered again (or until
+         * #processScheduledUpdates() is called), so a provider which gets modified many
+         * times within one operation (e.g. while executing an undo command group) is
+         * evaluated only once.
+         *
+         * @param provider      The provider to evaluate. Must call #cancelUpdate() before
+         *                      it gets destroyed.
+         */
+        void scheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+        void cancelUpdate(IF_ErcMsgProvider& provider) noexcept;
+
+        /**
+         * @brief Evaluate all scheduled providers now
+         *
+         * Emits #ercMsgsChanged() if any ERC message was added, removed or modified since
+         * the last call.
+         */
+        void processScheduledUpdates() noexcept;
+
         void restoreIgnoreState();
         bool save(bool toOriginal, QStringList& errors) noexcept;
         
@@ -79,9 +103,17 @@ class ErcMsgList final : public QObject, public SerializableObject
         void ercMsgRemoved(ErcMsg* ercMsg);
         void ercMsgChanged(ErcMsg* ercMsg);
 
+        /**
+         * @brief Batched notification, emitted at most once per event loop iteration
+         *        after any messages were added, removed or modified
+         */
+        void ercMsgsChanged();
+
 
     private: // Methods
 
+        void itemsModified() noexcept;
+
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
 
@@ -95,6 +127,12 @@ class ErcMsgList final : public QObject, public SerializableObject
 
         // Misc
         QList<ErcMsg*> mItems; ///< contains all visible ERC messages
+
+        // Deferred Evaluation
+        QList<IF_ErcMsgProvider*> mScheduledProviders; ///< in the order of scheduling
+        QSet<IF_ErcMsgProvider*> mScheduledProvidersSet; ///< same as above, for lookups
+        QTimer mProcessTimer; ///< single shot timer to process the scheduled updates
+        bool mItemsModified; ///< whether #ercMsgsChanged() needs to be emitted
 };
 
 /*****************************************************************************************
@@ -27,6 +27,7 @@ namespace librepcb {
 namespace project {
 
 class ErcMsg; // all classes which implement IF_ErcMsgProvider will need this declaration
+class ErcMsgList;
 
 /*****************************************************************************************
  *  Macros
@@ -63,6 +64,21 @@ class IF_ErcMsgProvider
 
         // Getters
         virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+
+    protected:
+
+        /**
+         * @brief Re-evaluate all ERC messages of this object
+         *
+         * Providers with expensive checks don't evaluate them immediately on every
+         * modification, but call ErcMsgList::scheduleUpdate() instead. The list then calls
+         * this method once per event loop iteration, no matter how often the update was
+         * scheduled in the meantime.
+         */
+        virtual void evaluateErcMessages() noexcept {}
+
+        friend class ErcMsgList;
 };
 
 /*****************************************************************************************
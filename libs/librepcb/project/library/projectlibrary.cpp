@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include <librepcb/common/exceptions.h>
 #include "projectlibrary.h"
 #include <librepcb/common/fileio/filepath.h>
@@ -56,17 +57,29 @@ ProjectLibrary::ProjectLibrary(Project& project, bool restore, bool readOnly) :
         FileUtils::makePath(mLibraryPath); // can throw
     }
 
+    // Start loading all library elements concurrently in the global thread pool...
+    QList<QFuture<Symbol*>>    symbols    = startLoadingElements<Symbol>   (mLibraryPath.getPathTo("sym"));
+    QList<QFuture<Package*>>   packages   = startLoadingElements<Package>  (mLibraryPath.getPathTo("pkg"));
+    QList<QFuture<Component*>> components = startLoadingElements<Component>(mLibraryPath.getPathTo("cmp"));
+    QList<QFuture<Device*>>    devices    = startLoadingElements<Device>   (mLibraryPath.getPathTo("dev"));
+
     try
     {
-        // Load all library elements
-        loadElements<Symbol>    (mLibraryPath.getPathTo("sym"),    "symbols",      mSymbols);
-        loadElements<Package>   (mLibraryPath.getPathTo("pkg"),    "packages",     mPackages);
-        loadElements<Component> (mLibraryPath.getPathTo("cmp"),    "components",   mComponents);
-        loadElements<Device>    (mLibraryPath.getPathTo("dev"),    "devices",      mDevices);
+        // ...and collect them in this thread
+        finishLoadingElements<Symbol>    (symbols,      "symbols",      mSymbols);
+        finishLoadingElements<Package>   (packages,     "packages",     mPackages);
+        finishLoadingElements<Component> (components,   "components",   mComponents);
+        finishLoadingElements<Device>    (devices,      "devices",      mDevices);
     }
     catch (Exception &e)
     {
-        // free the allocated memory in the reverse order of their allocation...
+        // wait for the elements which are still loading and delete them...
+        discardLoadingElements<Symbol>(symbols);
+        discardLoadingElements<Package>(packages);
+        discardLoadingElements<Component>(components);
+        discardLoadingElements<Device>(devices);
+
+        // ...and free the allocated memory in the reverse order of their allocation...
         qDeleteAll(mDevices);       mDevices.clear();
         qDeleteAll(mComponents);    mComponents.clear();
         qDeleteAll(mPackages);      mPackages.clear();
@@ -202,9 +215,9 @@ bool ProjectLibrary::save(bool toOriginal, QStringList& errors) noexcept
  ****************************************************************************************/
 
 template <typename ElementType>
-void ProjectLibrary::loadElements(const FilePath& directory, const QString& type,
-                                  QHash<Uuid, ElementType*>& elementList)
+QList<QFuture<ElementType*>> ProjectLibrary::startLoadingElements(const FilePath& directory) noexcept
 {
+    QList<QFuture<ElementType*>> futures;
     QDir dir(directory.toStr());
 
     // search all subdirectories which have a valid UUID as directory name
@@ -225,13 +238,33 @@ void ProjectLibrary::loadElements(const FilePath& directory, const QString& type
             continue;
         }
 
-        // load the library element --> an exception will be thrown on error
-        ElementType* element = new ElementType(subdirPath, false);
+        // load the library element in a worker thread --> on error, an exception will
+        // be thrown when retrieving the result of the future
+        QThread* thread = QThread::currentThread();
+        futures.append(QtConcurrent::run([subdirPath, thread]() -> ElementType* {
+            ElementType* element = new ElementType(subdirPath, false); // can throw
+            element->moveToThread(thread); // the element must live in the caller's thread
+            return element;
+        }));
+    }
+
+    return futures;
+}
+
+template <typename ElementType>
+void ProjectLibrary::finishLoadingElements(QList<QFuture<ElementType*>>& futures,
+                                           const QString& type,
+                                           QHash<Uuid, ElementType*>& elementList)
+{
+    while (!futures.isEmpty()) {
+        ElementType* element = futures.takeFirst().result(); // can throw
 
         if (elementList.contains(element->getUuid())) {
+            FilePath elementPath = element->getFilePath();
+            delete element;
             throw RuntimeError(__FILE__, __LINE__,
                 QString(tr("There are multiple library elements with the same "
-                "UUID in the directory \"%1\"")).arg(subdirPath.toNative()));
+                "UUID in the directory \"%1\"")).arg(elementPath.toNative()));
         }
 
         elementList.insert(element->getUuid(), element);
@@ -240,6 +273,19 @@ void ProjectLibrary::loadElements(const FilePath& directory, const QString& type
     qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
 }
 
+template <typename ElementType>
+void ProjectLibrary::discardLoadingElements(QList<QFuture<ElementType*>>& futures) noexcept
+{
+    foreach (QFuture<ElementType*> future, futures) {
+        try {
+            delete future.result(); // can throw
+        } catch (...) {
+            // the element could not be loaded, so there is nothing to delete
+        }
+    }
+    futures.clear();
+}
+
 template <typename ElementType>
 void ProjectLibrary::addElement(ElementType& element,
                                 QHash<Uuid, ElementType*>& elementList,
@@ -103,8 +103,13 @@ class ProjectLibrary final : public QObject
 
         // Private Methods
         template <typename ElementType>
-        void loadElements(const FilePath& directory, const QString& type,
-                          QHash<Uuid, ElementType*>& elementList);
+        QList<QFuture<ElementType*>> startLoadingElements(const FilePath& directory) noexcept;
+        template <typename ElementType>
+        void finishLoadingElements(QList<QFuture<ElementType*>>& futures,
+                                   const QString& type,
+                                   QHash<Uuid, ElementType*>& elementList);
+        template <typename ElementType>
+        void discardLoadingElements(QList<QFuture<ElementType*>>& futures) noexcept;
         template <typename ElementType>
         void addElement(ElementType& element,
                         QHash<Uuid, ElementType*>& elementList,
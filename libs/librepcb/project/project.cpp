@@ -21,7 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
-#include <QPrinter>
+#include <QtConcurrent/QtConcurrent>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/directorylock.h>
 #include <librepcb/common/fileio/smarttextfile.h>
@@ -34,6 +34,7 @@
 #include "library/projectlibrary.h"
 #include "circuit/circuit.h"
 #include "schematics/schematic.h"
+#include "schematics/schematicpdfexport.h"
 #include "erc/ercmsglist.h"
 #include "metadata/projectmetadata.h"
 #include "settings/projectsettings.h"
@@ -165,6 +166,18 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly, bool inte
     // This is done by a try/catch block. In the catch-block, all allocated memory will
     // be freed. Then the exception is rethrown to leave the constructor.
 
+    // The schematic and board files are parsed in worker threads while the other parts of
+    // the project are loaded, the schematics and boards are then built in this thread.
+    // The file objects are owned by these lists until they are passed to the schematics
+    // and boards, and on errors all workers must be finished before freeing them.
+    QList<SmartSExprFile*> schematicFiles;
+    QList<QFuture<SExpression>> schematicRoots;
+    QList<SmartSExprFile*> boardFiles;
+    QList<QFuture<SExpression>> boardRoots;
+    auto startParsingFile = [](const SmartSExprFile* file) {
+        return QtConcurrent::run(file, &SmartSExprFile::parseFileAndBuildDomTree);
+    };
+
     try
     {
         // try to create/open the version file
@@ -242,32 +255,7 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly, bool inte
             mProjectFile.reset(new SmartTextFile(mFilepath, mIsRestored, mIsReadOnly));
         }
 
-        // copy and/or load stroke fonts
-        FilePath fontobeneDir = mPath.getPathTo("resources/fontobene");
-        if (create || (!fontobeneDir.isExistingDir()) || fontobeneDir.isEmptyDir()) {
-            FilePath src = qApp->getResourcesFilePath("fontobene");
-            qInfo() << "No fonts found in project, copy application fonts from" << src.toNative();
-            // don't use FileUtils::copyDirRecursively() because we only want *.bene files
-            FileUtils::makePath(fontobeneDir);
-            foreach (const FilePath& fp, FileUtils::getFilesInDirectory(src, {"*.bene"})) {
-                FileUtils::copyFile(fp, fontobeneDir.getPathTo(fp.getFilename()));
-            }
-        }
-        mStrokeFontPool.reset(new StrokeFontPool(fontobeneDir));
-
-        // Create all needed objects
-        mProjectMetadata.reset(new ProjectMetadata(*this, mIsRestored, mIsReadOnly, create));
-        connect(mProjectMetadata.data(), &ProjectMetadata::attributesChanged,
-                this, &Project::attributesChanged);
-        mProjectSettings.reset(new ProjectSettings(*this, mIsRestored, mIsReadOnly, create));
-        mProjectLibrary.reset(new ProjectLibrary(*this, mIsRestored, mIsReadOnly));
-        mErcMsgList.reset(new ErcMsgList(*this, mIsRestored, mIsReadOnly, create));
-        mCircuit.reset(new Circuit(*this, mIsRestored, mIsReadOnly, create));
-
-        // Load all schematic layers
-        mSchematicLayerProvider.reset(new SchematicLayerProvider(*this));
-
-        // Load all schematics
+        // open all schematic files and start parsing them
         FilePath schematicsFilepath = mPath.getPathTo("schematics/schematics.lp");
         if (create) {
             mSchematicsFile.reset(SmartSExprFile::create(schematicsFilepath));
@@ -280,13 +268,12 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly, bool inte
                     // backward compatibility - remove this some time!
                     fp = mPath.getPathTo("schematics/" % fp.getBasename() % "/schematic.lp");
                 }
-                Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly);
-                addSchematic(*schematic);
+                schematicFiles.append(new SmartSExprFile(fp, mIsRestored, mIsReadOnly));
+                schematicRoots.append(startParsingFile(schematicFiles.last()));
             }
-            qDebug() << mSchematics.count() << "schematics successfully loaded!";
         }
 
-        // Load all boards
+        // open all board files and start parsing them
         FilePath boardsFilepath = mPath.getPathTo("boards/boards.lp");
         if (create) {
             mBoardsFile.reset(SmartSExprFile::create(boardsFilepath));
@@ -299,12 +286,56 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly, bool inte
                     // backward compatibility - remove this some time!
                     fp = mPath.getPathTo("boards/" % fp.getBasename() % "/board.lp");
                 }
-                Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly);
-                addBoard(*board);
+                boardFiles.append(new SmartSExprFile(fp, mIsRestored, mIsReadOnly));
+                boardRoots.append(startParsingFile(boardFiles.last()));
             }
-            qDebug() << mBoards.count() << "boards successfully loaded!";
         }
 
+        // copy and/or load stroke fonts
+        FilePath fontobeneDir = mPath.getPathTo("resources/fontobene");
+        if (create || (!fontobeneDir.isExistingDir()) || fontobeneDir.isEmptyDir()) {
+            FilePath src = qApp->getResourcesFilePath("fontobene");
+            qInfo() << "No fonts found in project, copy application fonts from" << src.toNative();
+            // don't use FileUtils::copyDirRecursively() because we only want *.bene files
+            FileUtils::makePath(fontobeneDir);
+            foreach (const FilePath& fp, FileUtils::getFilesInDirectory(src, {"*.bene"})) {
+                FileUtils::copyFile(fp, fontobeneDir.getPathTo(fp.getFilename()));
+            }
+        }
+        mStrokeFontPool.reset(new StrokeFontPool(fontobeneDir));
+
+        // Create all needed objects
+        mProjectMetadata.reset(new ProjectMetadata(*this, mIsRestored, mIsReadOnly, create));
+        connect(mProjectMetadata.data(), &ProjectMetadata::attributesChanged,
+                this, &Project::attributesChanged);
+        mProjectSettings.reset(new ProjectSettings(*this, mIsRestored, mIsReadOnly, create));
+        mProjectLibrary.reset(new ProjectLibrary(*this, mIsRestored, mIsReadOnly));
+        mErcMsgList.reset(new ErcMsgList(*this, mIsRestored, mIsReadOnly, create));
+        mCircuit.reset(new Circuit(*this, mIsRestored, mIsReadOnly, create));
+
+        // Load all schematic layers
+        mSchematicLayerProvider.reset(new SchematicLayerProvider(*this));
+
+        // Load all schematics (in the order of the parsed files)
+        while (!schematicFiles.isEmpty()) {
+            SExpression root = schematicRoots.first().result(); // can throw
+            schematicRoots.removeFirst();
+            std::unique_ptr<SmartSExprFile> file(schematicFiles.takeFirst());
+            Schematic* schematic = new Schematic(*this, std::move(file), root);
+            addSchematic(*schematic);
+        }
+        if (!create) qDebug() << mSchematics.count() << "schematics successfully loaded!";
+
+        // Load all boards (in the order of the parsed files)
+        while (!boardFiles.isEmpty()) {
+            SExpression root = boardRoots.first().result(); // can throw
+            boardRoots.removeFirst();
+            std::unique_ptr<SmartSExprFile> file(boardFiles.takeFirst());
+            Board* board = new Board(*this, std::move(file), root);
+            addBoard(*board);
+        }
+        if (!create) qDebug() << mBoards.count() << "boards successfully loaded!";
+
         // at this point, the whole circuit with all schematics and boards is successfully
         // loaded, so the ERC list now contains all the correct ERC messages.
         // So we can now restore the ignore state of each ERC message from the file.
@@ -321,6 +352,11 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly, bool inte
         foreach (Schematic* schematic, mSchematics) {
             try { removeSchematic(*schematic, true); } catch (...) {}
         }
+        foreach (QFuture<SExpression> future, boardRoots + schematicRoots) {
+            try { future.waitForFinished(); } catch (...) {} // rethrows parse errors
+        }
+        qDeleteAll(boardFiles);
+        qDeleteAll(schematicFiles);
         throw; // ...and rethrow the exception
     }
 
@@ -447,21 +483,12 @@ void Project::removeSchematic(Schematic& schematic, bool deleteSchematic)
 
 void Project::exportSchematicsAsPdf(const FilePath& filepath)
 {
-    // Create output directory first because QPrinter silently fails if it doesn't exist.
-    FileUtils::makePath(filepath.getParentDir()); // can throw
-
-    QPrinter printer(QPrinter::HighResolution);
-    printer.setPaperSize(QPrinter::A4);
-    printer.setOrientation(QPrinter::Landscape);
-    printer.setOutputFormat(QPrinter::PdfFormat);
-    printer.setCreator(QString("LibrePCB %1").arg(qApp->applicationVersion()));
-    printer.setOutputFileName(filepath.toStr());
-
     QList<int> pages;
     for (int i = 0; i < mSchematics.count(); i++)
         pages.append(i);
 
-    printSchematicPages(printer, pages);
+    SchematicPdfExport pdfExport(*this, pages); // can throw
+    pdfExport.exportPdf(filepath); // can throw
 }
 
 /*****************************************************************************************
@@ -591,6 +618,16 @@ void Project::save(bool toOriginal)
     Q_ASSERT(errors.isEmpty());
 }
 
+FileWriteBatch Project::createTemporarySaveBatch()
+{
+    FileWriteBatch batch;
+    {
+        FileWriteBatch::Recorder recorder(batch);
+        save(false); // can throw
+    }
+    return batch;
+}
+
 /*****************************************************************************************
  *  Inherited from AttributeProvider
  ****************************************************************************************/
@@ -785,35 +822,6 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
-void Project::printSchematicPages(QPrinter& printer, QList<int>& pages)
-{
-    if (pages.isEmpty())
-        throw RuntimeError(__FILE__, __LINE__, tr("No schematic pages selected."));
-
-    QPainter painter(&printer);
-
-    for (int i = 0; i < pages.count(); i++)
-    {
-        Schematic* schematic = getSchematicByIndex(pages[i]);
-        if (!schematic)
-        {
-            throw RuntimeError(__FILE__, __LINE__,
-                QString(tr("No schematic page with the index %1 found.")).arg(pages[i]));
-        }
-        schematic->clearSelection();
-        schematic->renderToQPainter(painter);
-
-        if (i != pages.count() - 1)
-        {
-            if (!printer.newPage())
-            {
-                throw RuntimeError(__FILE__, __LINE__,
-                    tr("Unknown error while printing."));
-            }
-        }
-    }
-}
-
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
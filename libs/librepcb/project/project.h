@@ -30,13 +30,12 @@
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/version.h>
 #include <librepcb/common/fileio/directorylock.h>
+#include <librepcb/common/fileio/filewritebatch.h>
 #include <librepcb/common/attributes/attribute.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
  ****************************************************************************************/
-class QPrinter;
-
 namespace librepcb {
 
 class SmartTextFile;
@@ -380,6 +379,19 @@ class Project final : public QObject, public AttributeProvider
          */
         void save(bool toOriginal);
 
+        /**
+         * @brief Capture the current state of the project for saving it to temporary files
+         *
+         * Everything is serialized in the calling thread, but the temporary files are not
+         * written until FileWriteBatch::execute() is called on the returned batch. This
+         * allows to write them in a worker thread, e.g. for autosaving the project.
+         *
+         * @return All pending file operations of the temporary save
+         *
+         * @throw Exception on error
+         */
+        FileWriteBatch createTemporarySaveBatch();
+
 
         // Inherited from AttributeProvider
         /// @copydoc librepcb::AttributeProvider::getUserDefinedAttributeValue()
@@ -467,16 +479,6 @@ class Project final : public QObject, public AttributeProvider
          */
         bool save(bool toOriginal, QStringList& errors) noexcept;
 
-        /**
-         * @brief Print some schematics to a QPrinter (printer or file)
-         *
-         * @param printer   The QPrinter where to print the schematic pages
-         * @param pages     A list with all schematic page indexes which should be printed
-         *
-         * @throw Exception     On error
-         */
-        void printSchematicPages(QPrinter& printer, QList<int>& pages);
-
 
         // Project File (*.lpp)
         FilePath mPath; ///< the path to the project directory
@@ -24,9 +24,11 @@ SOURCES += \
     boards/boardairwiresbuilder.cpp \
     boards/boardfabricationoutputsettings.cpp \
     boards/boardgerberexport.cpp \
+    boards/boardlayeritemvisitor.cpp \
     boards/boardlayerstack.cpp \
     boards/boardplanefragmentsbuilder.cpp \
     boards/boardselectionquery.cpp \
+    boards/boardsnapshotbuilder.cpp \
     boards/boardusersettings.cpp \
     boards/cmd/cmdboardadd.cpp \
     boards/cmd/cmdboarddesignrulesmodify.cpp \
@@ -60,6 +62,7 @@ SOURCES += \
     boards/graphicsitems/bgi_footprint.cpp \
     boards/graphicsitems/bgi_footprintpad.cpp \
     boards/graphicsitems/bgi_netline.cpp \
+    boards/graphicsitems/bgi_netlinebatch.cpp \
     boards/graphicsitems/bgi_netpoint.cpp \
     boards/graphicsitems/bgi_plane.cpp \
     boards/graphicsitems/bgi_via.cpp \
@@ -129,7 +132,9 @@ SOURCES += \
     schematics/items/si_symbolpin.cpp \
     schematics/schematic.cpp \
     schematics/schematiclayerprovider.cpp \
+    schematics/schematicpdfexport.cpp \
     schematics/schematicselectionquery.cpp \
+    schematics/schematicsnapshotbuilder.cpp \
     settings/cmd/cmdprojectsettingschange.cpp \
     settings/projectsettings.cpp \
 
@@ -138,9 +143,11 @@ HEADERS += \
     boards/boardairwiresbuilder.h \
     boards/boardfabricationoutputsettings.h \
     boards/boardgerberexport.h \
+    boards/boardlayeritemvisitor.h \
     boards/boardlayerstack.h \
     boards/boardplanefragmentsbuilder.h \
     boards/boardselectionquery.h \
+    boards/boardsnapshotbuilder.h \
     boards/boardusersettings.h \
     boards/cmd/cmdboardadd.h \
     boards/cmd/cmdboarddesignrulesmodify.h \
@@ -174,6 +181,7 @@ HEADERS += \
     boards/graphicsitems/bgi_footprint.h \
     boards/graphicsitems/bgi_footprintpad.h \
     boards/graphicsitems/bgi_netline.h \
+    boards/graphicsitems/bgi_netlinebatch.h \
     boards/graphicsitems/bgi_netpoint.h \
     boards/graphicsitems/bgi_plane.h \
     boards/graphicsitems/bgi_via.h \
@@ -244,7 +252,9 @@ HEADERS += \
     schematics/items/si_symbolpin.h \
     schematics/schematic.h \
     schematics/schematiclayerprovider.h \
+    schematics/schematicpdfexport.h \
     schematics/schematicselectionquery.h \
+    schematics/schematicsnapshotbuilder.h \
     settings/cmd/cmdprojectsettingschange.h \
     settings/projectsettings.h \
 
@@ -91,6 +91,22 @@ void CmdSchematicNetLabelEdit::rotate(const Angle& angle, const Point& center, b
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdSchematicNetLabelEdit::canMergeWith(const UndoCommand& other) const noexcept
+{
+    // only merge consecutive edits of the same object
+    const CmdSchematicNetLabelEdit* cmd = dynamic_cast<const CmdSchematicNetLabelEdit*>(&other);
+    return cmd && (&cmd->mNetLabel == &mNetLabel) &&
+           (cmd->mOldPos == mNewPos) &&
+           (cmd->mOldRotation == mNewRotation);
+}
+
+void CmdSchematicNetLabelEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    const CmdSchematicNetLabelEdit& cmd = static_cast<const CmdSchematicNetLabelEdit&>(other);
+    mNewPos = cmd.mNewPos;
+    mNewRotation = cmd.mNewRotation;
+}
+
 bool CmdSchematicNetLabelEdit::performExecute()
 {
     performRedo(); // can throw
@@ -77,6 +77,22 @@ void CmdSchematicNetPointEdit::setDeltaToStartPos(const Point& deltaPos, bool im
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdSchematicNetPointEdit::canMergeWith(const UndoCommand& other) const noexcept
+{
+    // only merge consecutive edits of the same object
+    const CmdSchematicNetPointEdit* cmd = dynamic_cast<const CmdSchematicNetPointEdit*>(&other);
+    return cmd && (&cmd->mNetPoint == &mNetPoint) &&
+           (cmd->mOldSymbolPin == mNewSymbolPin) &&
+           (cmd->mOldPos == mNewPos);
+}
+
+void CmdSchematicNetPointEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    const CmdSchematicNetPointEdit& cmd = static_cast<const CmdSchematicNetPointEdit&>(other);
+    mNewSymbolPin = cmd.mNewSymbolPin;
+    mNewPos = cmd.mNewPos;
+}
+
 bool CmdSchematicNetPointEdit::performExecute()
 {
     performRedo(); // can throw
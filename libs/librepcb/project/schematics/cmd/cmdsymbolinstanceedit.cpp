@@ -90,6 +90,22 @@ void CmdSymbolInstanceEdit::rotate(const Angle& angle, const Point& center, bool
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdSymbolInstanceEdit::canMergeWith(const UndoCommand& other) const noexcept
+{
+    // only merge consecutive edits of the same object
+    const CmdSymbolInstanceEdit* cmd = dynamic_cast<const CmdSymbolInstanceEdit*>(&other);
+    return cmd && (&cmd->mSymbol == &mSymbol) &&
+           (cmd->mOldPos == mNewPos) &&
+           (cmd->mOldRotation == mNewRotation);
+}
+
+void CmdSymbolInstanceEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    const CmdSymbolInstanceEdit& cmd = static_cast<const CmdSymbolInstanceEdit&>(other);
+    mNewPos = cmd.mNewPos;
+    mNewRotation = cmd.mNewRotation;
+}
+
 bool CmdSymbolInstanceEdit::performExecute()
 {
     performRedo(); // can throw
@@ -57,6 +57,15 @@ class CmdSymbolInstanceEdit final : public UndoCommand
         void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::canMergeWith()
+        bool canMergeWith(const UndoCommand& other) const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        void mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
@@ -53,8 +53,7 @@ SGI_NetLabel::SGI_NetLabel(SI_NetLabel& netlabel) noexcept :
     mStaticText.setTextFormat(Qt::PlainText);
     mStaticText.setPerformanceHint(QStaticText::AggressiveCaching);
 
-    mFont = qApp->getDefaultMonospaceFont();
-    mFont.setPixelSize(4);
+    mFont = getFont();
 
     if (sOriginCrossLines.isEmpty())
     {
@@ -168,6 +167,17 @@ void SGI_NetLabel::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
 #endif
 }
 
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QFont SGI_NetLabel::getFont() noexcept
+{
+    QFont font = qApp->getDefaultMonospaceFont();
+    font.setPixelSize(4);
+    return font;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -62,6 +62,9 @@ class SGI_NetLabel final : public SGI_Base
         QRectF boundingRect() const {return mBoundingRect;}
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
 
+        // Static Methods (the layout is also used by SchematicSnapshotBuilder)
+        static QFont getFont() noexcept;
+
 
     private:
 
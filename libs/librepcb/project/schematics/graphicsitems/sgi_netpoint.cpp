@@ -52,7 +52,7 @@ SGI_NetPoint::SGI_NetPoint(SI_NetPoint& netpoint) noexcept :
 
     if (sBoundingRect.isNull())
     {
-        qreal radius = Length(600000).toPx();
+        qreal radius = getJunctionRadius()->toPx();
         sBoundingRect = QRectF(-radius, -radius, 2*radius, 2*radius);
     }
 
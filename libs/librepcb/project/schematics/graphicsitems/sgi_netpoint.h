@@ -60,6 +60,9 @@ class SGI_NetPoint final : public SGI_Base
         QRectF boundingRect() const {return sBoundingRect;}
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
 
+        // Static Methods (the layout is also used by SchematicSnapshotBuilder)
+        static UnsignedLength getJunctionRadius() noexcept {return UnsignedLength(600000);}
+
 
     private:
 
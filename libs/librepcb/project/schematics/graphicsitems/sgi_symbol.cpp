@@ -133,6 +133,18 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
     update();
 }
 
+void SGI_Symbol::updateSubstitutedTexts() noexcept
+{
+    // rebuilding the cache is expensive, so skip it if no displayed text has changed
+    for (const Text& text : mLibSymbol.getTexts()) {
+        QString str = AttributeSubstitutor::substitute(text.getText(), &mSymbol);
+        if (str != mCachedTextProperties.value(&text).text) {
+            updateCacheAndRepaint();
+            return;
+        }
+    }
+}
+
 /*****************************************************************************************
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
@@ -64,6 +64,7 @@ class SGI_Symbol final : public SGI_Base
 
         // General Methods
         void updateCacheAndRepaint() noexcept;
+        void updateSubstitutedTexts() noexcept; ///< only repaints if a text has changed
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept {return mBoundingRect;}
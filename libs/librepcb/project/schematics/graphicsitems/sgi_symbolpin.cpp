@@ -56,8 +56,7 @@ SGI_SymbolPin::SGI_SymbolPin(SI_SymbolPin& pin) noexcept :
     mStaticText.setTextFormat(Qt::PlainText);
     mStaticText.setPerformanceHint(QStaticText::AggressiveCaching);
 
-    mFont = qApp->getDefaultSansSerifFont();
-    mFont.setPixelSize(5);
+    mFont = getTextFont();
 
     mRadiusPx = Length(600000).toPx();
 
@@ -93,7 +92,7 @@ void SGI_SymbolPin::updateCacheAndRepaint() noexcept
     mBoundingRect = mBoundingRect.united(lineRect).normalized();
 
     // text
-    qreal x = mLibPin.getLength()->toPx() + 4;
+    qreal x = mLibPin.getLength()->toPx() + getTextSpacingPx();
     mStaticText.setText(mPin.getDisplayText());
     mStaticText.prepare(QTransform(), mFont);
     mTextOrigin.setX(mRotate180 ? -x-mStaticText.size().width() : x);
@@ -126,7 +125,7 @@ void SGI_SymbolPin::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     GraphicsLayer* layer = getLayer(GraphicsLayer::sSymbolOutlines); Q_ASSERT(layer);
     if (layer->isVisible())
     {
-        painter->setPen(QPen(layer->getColor(highlight), Length(158750).toPx(), Qt::SolidLine, Qt::RoundCap));
+        painter->setPen(QPen(layer->getColor(highlight), getLineWidth()->toPx(), Qt::SolidLine, Qt::RoundCap));
         painter->drawLine(QPointF(0, 0), Point(*mLibPin.getLength(), 0).toPxQPointF());
     }
 
@@ -199,6 +198,17 @@ void SGI_SymbolPin::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
 #endif
 }
 
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QFont SGI_SymbolPin::getTextFont() noexcept
+{
+    QFont font = qApp->getDefaultSansSerifFont();
+    font.setPixelSize(5);
+    return font;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -68,6 +68,11 @@ class SGI_SymbolPin final : public SGI_Base
         QPainterPath shape() const noexcept {return mShape;}
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0);
 
+        // Static Methods (the layout is also used by SchematicSnapshotBuilder)
+        static UnsignedLength getLineWidth() noexcept {return UnsignedLength(158750);}
+        static qreal getTextSpacingPx() noexcept {return 4;} ///< between line and text
+        static QFont getTextFont() noexcept;
+
 
     private:
 
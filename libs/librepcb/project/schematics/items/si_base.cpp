@@ -82,6 +82,7 @@ void SI_Base::addToSchematic(SGI_Base* item) noexcept
         mSchematic.getGraphicsScene().addItem(*item);
     }
     mIsAddedToSchematic = true;
+    mSchematic.updateItemIndex(*this);
 }
 
 void SI_Base::removeFromSchematic(SGI_Base* item) noexcept
@@ -91,6 +92,14 @@ void SI_Base::removeFromSchematic(SGI_Base* item) noexcept
         mSchematic.getGraphicsScene().removeItem(*item);
     }
     mIsAddedToSchematic = false;
+    mSchematic.removeFromItemIndex(*this);
+}
+
+void SI_Base::grabAreaChanged() noexcept
+{
+    if (mIsAddedToSchematic) {
+        mSchematic.updateItemIndex(*this);
+    }
 }
 
 /*****************************************************************************************
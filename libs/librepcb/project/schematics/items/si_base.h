@@ -97,6 +97,14 @@ class SI_Base : public QObject
         void addToSchematic(SGI_Base* item) noexcept;
         void removeFromSchematic(SGI_Base* item) noexcept;
 
+        /**
+         * @brief Must be called whenever the grab area has been modified (e.g. moved)
+         *
+         * Updates the item index of the schematic, which is used to find items by their
+         * position (see Schematic::getItemsAtScenePos()).
+         */
+        void grabAreaChanged() noexcept;
+
 
     protected:
 
@@ -87,6 +87,7 @@ void SI_NetLabel::setPosition(const Point& position) noexcept
     if (position != mPosition) {
         mPosition = position;
         mGraphicsItem->setPos(mPosition.toPxQPointF());
+        grabAreaChanged();
         updateAnchor();
     }
 }
@@ -97,6 +98,7 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
         mRotation = rotation;
         mGraphicsItem->setRotation(-mRotation.toDeg());
         mGraphicsItem->updateCacheAndRepaint();
+        grabAreaChanged();
         updateAnchor();
     }
 }
@@ -120,6 +122,7 @@ void SI_NetLabel::addToSchematic()
                                           [this](){mGraphicsItem->update();});
     SI_Base::addToSchematic(mGraphicsItem.data());
     mGraphicsItem->updateCacheAndRepaint();
+    grabAreaChanged();
     updateAnchor();
 }
 
@@ -143,6 +143,7 @@ void SI_NetLine::setWidth(const UnsignedLength& width) noexcept
     if (width != mWidth) {
         mWidth = width;
         mGraphicsItem->updateCacheAndRepaint();
+        grabAreaChanged();
     }
 }
 
@@ -186,6 +187,7 @@ void SI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
     mGraphicsItem->updateCacheAndRepaint();
+    grabAreaChanged();
 }
 
 void SI_NetLine::serialize(SExpression& root) const
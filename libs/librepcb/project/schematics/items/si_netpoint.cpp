@@ -168,6 +168,7 @@ void SI_NetPoint::setPinToAttach(SI_SymbolPin* pin)
     }
     mSymbolPin = pin;
     mGraphicsItem->updateCacheAndRepaint();
+    grabAreaChanged();
 }
 
 void SI_NetPoint::setPosition(const Point& position) noexcept
@@ -175,6 +176,7 @@ void SI_NetPoint::setPosition(const Point& position) noexcept
     if (position != mPosition) {
         mPosition = position;
         mGraphicsItem->setPos(mPosition.toPxQPointF());
+        grabAreaChanged();
         updateLines();
     }
 }
@@ -233,6 +235,7 @@ void SI_NetPoint::registerNetLine(SI_NetLine& netline)
     mRegisteredLines.append(&netline);
     netline.updateLine();
     mGraphicsItem->updateCacheAndRepaint();
+    grabAreaChanged();
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
 }
 
@@ -244,6 +247,7 @@ void SI_NetPoint::unregisterNetLine(SI_NetLine& netline)
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
     mGraphicsItem->updateCacheAndRepaint();
+    grabAreaChanged();
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
 }
 
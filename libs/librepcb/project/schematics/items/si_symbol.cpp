@@ -139,6 +139,7 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept
         mPosition = newPos;
         mGraphicsItem->setPos(newPos.toPxQPointF());
         mGraphicsItem->updateCacheAndRepaint();
+        grabAreaChanged();
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -151,6 +152,7 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept
         mRotation = newRotation;
         mGraphicsItem->setRotation(-newRotation.toDeg());
         mGraphicsItem->updateCacheAndRepaint();
+        grabAreaChanged();
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -255,7 +257,8 @@ void SI_Symbol::setSelected(bool selected) noexcept
 
 void SI_Symbol::schematicOrComponentAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    mGraphicsItem->updateSubstitutedTexts();
+    grabAreaChanged();
 }
 
 /*****************************************************************************************
@@ -30,6 +30,7 @@
 #include "si_netpoint.h"
 #include "../../circuit/componentsignalinstance.h"
 #include "../../erc/ercmsg.h"
+#include "../../erc/ercmsglist.h"
 #include "../schematic.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
@@ -71,6 +72,7 @@ SI_SymbolPin::SI_SymbolPin(SI_Symbol& symbol, const Uuid& pinUuid) :
 
 SI_SymbolPin::~SI_SymbolPin()
 {
+    mSchematic.getProject().getErcMsgList().cancelUpdate(*this);
     Q_ASSERT(!isUsed());
     mGraphicsItem.reset();
 }
@@ -195,6 +197,7 @@ void SI_SymbolPin::updatePosition() noexcept
     mGraphicsItem->setPos(mPosition.toPxQPointF());
     mGraphicsItem->setRotation(-mRotation.toDeg());
     mGraphicsItem->updateCacheAndRepaint();
+    grabAreaChanged();
     if (mRegisteredNetPoint) {
         mRegisteredNetPoint->setPosition(mPosition);
     }
@@ -220,6 +223,11 @@ void SI_SymbolPin::setSelected(bool selected) noexcept
  ****************************************************************************************/
 
 void SI_SymbolPin::updateErcMessages() noexcept
+{
+    mSchematic.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
+void SI_SymbolPin::evaluateErcMessages() noexcept
 {
     mErcMsgUnconnectedRequiredPin->setMsg(
         QString(tr("Unconnected pin: \"%1\" of symbol \"%2\""))
@@ -104,6 +104,8 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
 
     private:
 
+        void evaluateErcMessages() noexcept override;
+
         // General
         SI_Symbol& mSymbol;
         const library::SymbolPin* mSymbolPin;
@@ -49,20 +49,26 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
-                     bool readOnly, bool create, const QString& newName):
-    QObject(&project), AttributeProvider(), mProject(project), mFilePath(filepath),
-    mIsAddedToProject(false), mUuid(Uuid::createRandom()), mName("New Page")
+Schematic::Schematic(Project& project, std::unique_ptr<SmartSExprFile> file,
+                     const SExpression& root) :
+    Schematic(project, std::move(file), &root, QString())
+{
+}
+
+Schematic::Schematic(Project& project, std::unique_ptr<SmartSExprFile> file,
+                     const SExpression* root, const QString& newName):
+    QObject(&project), AttributeProvider(), mProject(project),
+    mFilePath(file->getFilepath()),
+    mIsAddedToProject(false), mUuid(Uuid::createRandom()), mName("New Page"),
+    mItemIndex(Length(10160000).toPx()) // 4x the default grid interval
 {
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
+        mFile.reset(file.release());
 
-        // try to open/create the schematic file
-        if (create)
+        if (!root)
         {
-            mFile.reset(SmartSExprFile::create(mFilePath));
-
             // set attributes
             mName = newName;
 
@@ -71,24 +77,21 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
         }
         else
         {
-            mFile.reset(new SmartSExprFile(mFilePath, restore, readOnly));
-            SExpression root = mFile->parseFileAndBuildDomTree();
-
             // the schematic seems to be ready to open, so we will create all needed objects
 
-            if (root.getChildByIndex(0).isString()) {
-                mUuid = root.getChildByIndex(0).getValue<Uuid>();
+            if (root->getChildByIndex(0).isString()) {
+                mUuid = root->getChildByIndex(0).getValue<Uuid>();
             } else {
                 // backward compatibility, remove this some time!
-                mUuid = root.getValueByPath<Uuid>("uuid");
+                mUuid = root->getValueByPath<Uuid>("uuid");
             }
-            mName = root.getValueByPath<ElementName>("name");
+            mName = root->getValueByPath<ElementName>("name");
 
             // Load grid properties
-            mGridProperties.reset(new GridProperties(root.getChildByPath("grid")));
+            mGridProperties.reset(new GridProperties(root->getChildByPath("grid")));
 
             // Load all symbols
-            foreach (const SExpression& node, root.getChildren("symbol")) {
+            foreach (const SExpression& node, root->getChildren("symbol")) {
                 SI_Symbol* symbol = new SI_Symbol(*this, node);
                 if (getSymbolByUuid(symbol->getUuid())) {
                     throw RuntimeError(__FILE__, __LINE__,
@@ -99,7 +102,7 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
             }
 
             // Load all netsegments
-            foreach (const SExpression& node, root.getChildren("netsegment")) {
+            foreach (const SExpression& node, root->getChildren("netsegment")) {
                 SI_NetSegment* netsegment = new SI_NetSegment(*this, node);
                 if (getNetSegmentByUuid(netsegment->getUuid())) {
                     throw RuntimeError(__FILE__, __LINE__,
@@ -149,12 +152,26 @@ bool Schematic::isEmpty() const noexcept
 
 QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept
 {
-    QPointF scenePosPx = pos.toPxQPointF();
+    QList<SI_NetPoint*> netpoints;
+    QList<SI_NetLine*> netlines;
+    QList<SI_NetLabel*> netlabels;
+    QList<SI_SymbolPin*> pins;
+    QList<SI_Symbol*> symbols;
+    foreach (SI_Base* item, findItemsAtScenePos(pos)) {
+        switch (item->getType()) {
+            case SI_Base::Type_t::NetPoint:  netpoints.append(static_cast<SI_NetPoint*>(item)); break;
+            case SI_Base::Type_t::NetLine:   netlines.append(static_cast<SI_NetLine*>(item)); break;
+            case SI_Base::Type_t::NetLabel:  netlabels.append(static_cast<SI_NetLabel*>(item)); break;
+            case SI_Base::Type_t::SymbolPin: pins.append(static_cast<SI_SymbolPin*>(item)); break;
+            case SI_Base::Type_t::Symbol:    symbols.append(static_cast<SI_Symbol*>(item)); break;
+            default: break;
+        }
+    }
+
     QList<SI_Base*> list;   // Note: The order of adding the items is very important (the
                             // top most item must appear as the first item in the list)!
 
     // visible netpoints
-    const QList<SI_NetPoint*> netpoints(getNetPointsAtScenePos(pos));
     foreach (SI_NetPoint* netpoint, netpoints) {
         if (netpoint->isVisibleJunction()) {
             list.append(netpoint);
@@ -167,39 +184,49 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept
         }
     }
     // netlines
-    foreach (SI_NetLine* netline, getNetLinesAtScenePos(pos)) {
+    foreach (SI_NetLine* netline, netlines) {
         list.append(netline);
     }
     // netlabels
-    foreach (SI_NetLabel* netlabel, getNetLabelsAtScenePos(pos)) {
+    foreach (SI_NetLabel* netlabel, netlabels) {
         list.append(netlabel);
     }
-    // symbols & pins
-    foreach (SI_Symbol* symbol, mSymbols) {
-        foreach (SI_SymbolPin* pin, symbol->getPins()) {
-            if (pin->getGrabAreaScenePx().contains(scenePosPx))
-                list.append(pin);
-        }
-        if (symbol->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(symbol);
+    // pins & symbols
+    foreach (SI_SymbolPin* pin, pins) {
+        list.append(pin);
+    }
+    foreach (SI_Symbol* symbol, symbols) {
+        list.append(symbol);
     }
     return list;
 }
 
-QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const noexcept
+QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos,
+    const SI_NetSegment* netsegment) const noexcept
 {
     QList<SI_NetPoint*> list;
-    foreach (SI_NetSegment* segment, mNetSegments) {
-        segment->getNetPointsAtScenePos(pos, list);
+    foreach (SI_Base* item, findItemsAtScenePos(pos)) {
+        if (item->getType() == SI_Base::Type_t::NetPoint) {
+            SI_NetPoint* netpoint = static_cast<SI_NetPoint*>(item);
+            if ((!netsegment) || (&netpoint->getNetSegment() == netsegment)) {
+                list.append(netpoint);
+            }
+        }
     }
     return list;
 }
 
-QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const noexcept
+QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos,
+    const SI_NetSegment* netsegment) const noexcept
 {
     QList<SI_NetLine*> list;
-    foreach (SI_NetSegment* segment, mNetSegments) {
-        segment->getNetLinesAtScenePos(pos, list);
+    foreach (SI_Base* item, findItemsAtScenePos(pos)) {
+        if (item->getType() == SI_Base::Type_t::NetLine) {
+            SI_NetLine* netline = static_cast<SI_NetLine*>(item);
+            if ((!netsegment) || (&netline->getNetSegment() == netsegment)) {
+                list.append(netline);
+            }
+        }
     }
     return list;
 }
@@ -207,8 +234,10 @@ QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const noex
 QList<SI_NetLabel*> Schematic::getNetLabelsAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_NetLabel*> list;
-    foreach (SI_NetSegment* segment, mNetSegments) {
-        segment->getNetLabelsAtScenePos(pos, list);
+    foreach (SI_Base* item, findItemsAtScenePos(pos)) {
+        if (item->getType() == SI_Base::Type_t::NetLabel) {
+            list.append(static_cast<SI_NetLabel*>(item));
+        }
     }
     return list;
 }
@@ -216,12 +245,9 @@ QList<SI_NetLabel*> Schematic::getNetLabelsAtScenePos(const Point& pos) const no
 QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_SymbolPin*> list;
-    foreach (SI_Symbol* symbol, mSymbols)
-    {
-        foreach (SI_SymbolPin* pin, symbol->getPins())
-        {
-            if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-                list.append(pin);
+    foreach (SI_Base* item, findItemsAtScenePos(pos)) {
+        if (item->getType() == SI_Base::Type_t::SymbolPin) {
+            list.append(static_cast<SI_SymbolPin*>(item));
         }
     }
     return list;
@@ -431,11 +457,6 @@ void Schematic::updateAllNetLabelAnchors() noexcept
     }
 }
 
-void Schematic::renderToQPainter(QPainter& painter) const noexcept
-{
-    mGraphicsScene->render(&painter, QRectF(), mGraphicsScene->itemsBoundingRect(), Qt::KeepAspectRatio);
-}
-
 std::unique_ptr<SchematicSelectionQuery> Schematic::createSelectionQuery() const noexcept
 {
     return std::unique_ptr<SchematicSelectionQuery>(
@@ -478,6 +499,33 @@ void Schematic::updateIcon() noexcept
     mIcon = QIcon(pixmap);
 }
 
+QList<SI_Base*> Schematic::findItemsAtScenePos(const Point& pos) const noexcept
+{
+    QPointF scenePosPx = pos.toPxQPointF();
+    QList<SI_Base*> items;
+    foreach (SI_Base* item, mItemIndex.find(scenePosPx)) {
+        if (item->getGrabAreaScenePx().contains(scenePosPx)) {
+            items.append(item);
+        }
+    }
+    return items;
+}
+
+void Schematic::updateItemIndex(SI_Base& item) noexcept
+{
+    QRectF rect = item.getGrabAreaScenePx().boundingRect();
+    if (rect.isEmpty()) {
+        mItemIndex.remove(&item); // items without grab area can't be found anyway
+    } else {
+        mItemIndex.insert(&item, rect);
+    }
+}
+
+void Schematic::removeFromItemIndex(SI_Base& item) noexcept
+{
+    mItemIndex.remove(&item);
+}
+
 void Schematic::serialize(SExpression& root) const
 {
     root.appendChild(mUuid);
@@ -497,7 +545,8 @@ void Schematic::serialize(SExpression& root) const
 Schematic* Schematic::create(Project& project, const FilePath& filepath,
                              const ElementName& name)
 {
-    return new Schematic(project, filepath, false, false, true, *name);
+    std::unique_ptr<SmartSExprFile> file(SmartSExprFile::create(filepath)); // can throw
+    return new Schematic(project, std::move(file), nullptr, *name);
 }
 
 /*****************************************************************************************
@@ -33,6 +33,7 @@
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/elementname.h>
 #include <librepcb/common/exceptions.h>
+#include <librepcb/common/utils/spatialgridindex.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -108,8 +109,18 @@ class Schematic final : public QObject, public AttributeProvider,
         // Constructors / Destructor
         Schematic() = delete;
         Schematic(const Schematic& other) = delete;
-        Schematic(Project& project, const FilePath& filepath, bool restore, bool readOnly) :
-            Schematic(project, filepath, restore, readOnly, false, QString()) {}
+
+        /**
+         * @brief Open an existing schematic
+         *
+         * @param project   The project of the schematic
+         * @param file      The opened schematic file
+         * @param root      The already parsed content of @p file (see
+         *                  SmartSExprFile::parseFileAndBuildDomTree()), which allows
+         *                  to parse the files of several schematics in parallel
+         */
+        Schematic(Project& project, std::unique_ptr<SmartSExprFile> file,
+                  const SExpression& root);
         ~Schematic() noexcept;
 
         // Getters: General
@@ -119,8 +130,10 @@ class Schematic final : public QObject, public AttributeProvider,
         GraphicsScene& getGraphicsScene () const noexcept {return *mGraphicsScene;}
         bool isEmpty() const noexcept;
         QList<SI_Base*> getItemsAtScenePos(const Point& pos) const noexcept;
-        QList<SI_NetPoint*> getNetPointsAtScenePos(const Point& pos) const noexcept;
-        QList<SI_NetLine*> getNetLinesAtScenePos(const Point& pos) const noexcept;
+        QList<SI_NetPoint*> getNetPointsAtScenePos(const Point& pos,
+            const SI_NetSegment* netsegment = nullptr) const noexcept;
+        QList<SI_NetLine*> getNetLinesAtScenePos(const Point& pos,
+            const SI_NetSegment* netsegment = nullptr) const noexcept;
         QList<SI_NetLabel*> getNetLabelsAtScenePos(const Point& pos) const noexcept;
         QList<SI_SymbolPin*> getPinsAtScenePos(const Point& pos) const noexcept;
 
@@ -139,6 +152,7 @@ class Schematic final : public QObject, public AttributeProvider,
         void removeSymbol(SI_Symbol& symbol);
 
         // NetSegment Methods
+        const QList<SI_NetSegment*>& getNetSegments() const noexcept {return mNetSegments;}
         SI_NetSegment* getNetSegmentByUuid(const Uuid& uuid) const noexcept;
         void addNetSegment(SI_NetSegment& netsegment);
         void removeNetSegment(SI_NetSegment& netsegment);
@@ -153,7 +167,6 @@ class Schematic final : public QObject, public AttributeProvider,
         void setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept;
         void clearSelection() const noexcept;
         void updateAllNetLabelAnchors() noexcept;
-        void renderToQPainter(QPainter& painter) const noexcept;
         std::unique_ptr<SchematicSelectionQuery> createSelectionQuery() const noexcept;
 
         // Inherited from AttributeProvider
@@ -180,9 +193,15 @@ class Schematic final : public QObject, public AttributeProvider,
 
     private:
 
-        Schematic(Project& project, const FilePath& filepath, bool restore,
-                  bool readOnly, bool create, const QString& newName);
+        Schematic(Project& project, std::unique_ptr<SmartSExprFile> file,
+                  const SExpression* root, const QString& newName);
         void updateIcon() noexcept;
+        QList<SI_Base*> findItemsAtScenePos(const Point& pos) const noexcept;
+
+        // Item Index (maintained by SI_Base)
+        void updateItemIndex(SI_Base& item) noexcept;
+        void removeFromItemIndex(SI_Base& item) noexcept;
+        friend class SI_Base;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -205,6 +224,14 @@ class Schematic final : public QObject, public AttributeProvider,
 
         QList<SI_Symbol*> mSymbols;
         QList<SI_NetSegment*> mNetSegments;
+
+        /**
+         * @brief Bounding rectangles of the grab areas of all items added to the schematic
+         *
+         * Used to avoid checking the grab area of every single item when looking for
+         * items at a specific position, e.g. on every mouse move.
+         */
+        SpatialGridIndex<SI_Base*> mItemIndex;
 };
 
 /*****************************************************************************************
@@ -0,0 +1,151 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include <QPdfWriter>
+#include <QPicture>
+#include "schematicpdfexport.h"
+#include "schematic.h"
+#include "schematicsnapshotbuilder.h"
+#include "../project.h"
+#include "../metadata/projectmetadata.h"
+#include <librepcb/common/application.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/fileutils.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SchematicPdfExport::SchematicPdfExport(const Project& project, const QList<int>& pages) :
+    QObject(nullptr), mTitle(*project.getMetadata().getName()), mCanceled(0)
+{
+    if (pages.isEmpty()) {
+        throw RuntimeError(__FILE__, __LINE__, tr("No schematic pages selected."));
+    }
+
+    foreach (int index, pages) {
+        const Schematic* schematic = project.getSchematicByIndex(index);
+        if (!schematic) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("No schematic page with the index %1 found.")).arg(index));
+        }
+        mPages.append(SchematicSnapshotBuilder(*schematic).build());
+    }
+}
+
+SchematicPdfExport::~SchematicPdfExport() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void SchematicPdfExport::exportPdf(const FilePath& filepath)
+{
+    // Create output directory first because QPdfWriter silently fails if it doesn't exist.
+    FileUtils::makePath(filepath.getParentDir()); // can throw
+
+    QPdfWriter writer(filepath.toStr());
+    writer.setPageSizeMM(QSizeF(297, 210)); // A4 landscape
+    writer.setMargins({10, 10, 10, 10});
+    writer.setCreator(QString("LibrePCB %1").arg(qApp->applicationVersion()));
+    writer.setTitle(mTitle);
+    const QRectF pageRect(0, 0, writer.width(), writer.height());
+
+    // Render all pages concurrently into pictures. The actual PDF writing below is
+    // sequential anyway, so it can already start with the first page while the
+    // following pages are still being rendered.
+    const QAtomicInt* canceled = &mCanceled;
+    QList<QFuture<QPicture>> futures;
+    foreach (const GraphicsSnapshot& page, mPages) {
+        futures.append(QtConcurrent::run([page, pageRect, canceled]() {
+            QPicture picture;
+            if ((canceled->load() == 0) && (!page.isEmpty())) {
+                // fit the page content into the page rect, keeping the aspect ratio
+                QRectF rect = page.getBoundingRect();
+                qreal scale = qMin(pageRect.width() / qMax(rect.width(), qreal(1)),
+                                   pageRect.height() / qMax(rect.height(), qreal(1)));
+                QPainter painter(&picture);
+                painter.translate(pageRect.center());
+                painter.scale(scale, scale);
+                painter.translate(-rect.center());
+                page.paint(painter);
+            }
+            return picture;
+        }));
+    }
+    auto waitForFutures = [&futures]() {
+        for (QFuture<QPicture>& future : futures) {
+            future.waitForFinished();
+        }
+    };
+
+    // write the pages in the correct order
+    QPainter painter;
+    if (!painter.begin(&writer)) {
+        waitForFutures();
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Could not write the PDF "
+            "file \"%1\".")).arg(filepath.toNative()));
+    }
+    for (int i = 0; i < futures.count(); ++i) {
+        QPicture picture = futures[i].result(); // blocks until the page is rendered
+        if (isCanceled()) {
+            painter.end();
+            waitForFutures();
+            QFile::remove(filepath.toStr()); // remove the incomplete file
+            throw UserCanceled(__FILE__, __LINE__);
+        }
+        if ((i > 0) && (!writer.newPage())) {
+            painter.end();
+            waitForFutures();
+            throw RuntimeError(__FILE__, __LINE__, tr("Unknown error while printing."));
+        }
+        painter.drawPicture(0, 0, picture);
+        emit progress(i + 1, futures.count());
+    }
+    if (!painter.end()) {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Could not write the PDF "
+            "file \"%1\".")).arg(filepath.toNative()));
+    }
+}
+
+void SchematicPdfExport::cancel() noexcept
+{
+    mCanceled.store(1);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,128 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_PROJECT_SCHEMATICPDFEXPORT_H
+#define LIBREPCB_PROJECT_SCHEMATICPDFEXPORT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/graphics/graphicssnapshot.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class FilePath;
+
+namespace project {
+
+class Project;
+
+/*****************************************************************************************
+ *  Class SchematicPdfExport
+ ****************************************************************************************/
+
+/**
+ * @brief Exports schematic pages into a PDF file
+ *
+ * The constructor records all pages into librepcb::GraphicsSnapshot objects, which must
+ * be done in the thread the project lives in. Afterwards the export is independent of
+ * the project, so #exportPdf() can be called from a worker thread to not block the GUI
+ * (the project may even be modified or closed in the meantime).
+ *
+ * The pages are rendered concurrently and written into the PDF in the page order as
+ * soon as they are finished. The progress is reported with the #progress() signal and
+ * a running export can be aborted with #cancel().
+ */
+class SchematicPdfExport final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        SchematicPdfExport() = delete;
+        SchematicPdfExport(const SchematicPdfExport& other) = delete;
+
+        /**
+         * @brief Constructor
+         *
+         * @param project   The project to export
+         * @param pages     The indices of all schematic pages to export
+         *
+         * @throw Exception If no pages are selected or a page does not exist
+         */
+        SchematicPdfExport(const Project& project, const QList<int>& pages);
+        ~SchematicPdfExport() noexcept;
+
+        // Getters
+        int getPageCount() const noexcept {return mPages.count();}
+        bool isCanceled() const noexcept {return mCanceled.load() != 0;}
+
+        // General Methods
+
+        /**
+         * @brief Write the PDF file (blocks until it is written, reentrant)
+         *
+         * @param filepath  The filepath where the PDF should be saved. If the file exists
+         *                  already, it will be overwritten.
+         *
+         * @throw UserCanceled  If the export was canceled with #cancel()
+         * @throw Exception     On other errors
+         */
+        void exportPdf(const FilePath& filepath);
+
+        /**
+         * @brief Abort the running (or next) export (thread safe)
+         */
+        void cancel() noexcept;
+
+        // Operator Overloadings
+        SchematicPdfExport& operator=(const SchematicPdfExport& rhs) = delete;
+
+
+    signals:
+
+        /**
+         * @brief Emitted (from the exporting thread) after a page was written
+         *
+         * @param finishedPages     Count of pages written so far
+         * @param totalPages        Count of pages to write
+         */
+        void progress(int finishedPages, int totalPages);
+
+
+    private: // Data
+        QString mTitle;
+        QList<GraphicsSnapshot> mPages;
+        QAtomicInt mCanceled;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_SCHEMATICPDFEXPORT_H
@@ -0,0 +1,255 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "schematicsnapshotbuilder.h"
+#include "schematic.h"
+#include "schematiclayerprovider.h"
+#include "items/si_symbol.h"
+#include "items/si_symbolpin.h"
+#include "items/si_netsegment.h"
+#include "items/si_netpoint.h"
+#include "items/si_netline.h"
+#include "items/si_netlabel.h"
+#include "graphicsitems/sgi_symbolpin.h"
+#include "graphicsitems/sgi_netpoint.h"
+#include "graphicsitems/sgi_netlabel.h"
+#include "../project.h"
+#include "../circuit/netsignal.h"
+#include <librepcb/common/application.h>
+#include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/sym/symbol.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SchematicSnapshotBuilder::SchematicSnapshotBuilder(const Schematic& schematic) noexcept :
+    mSchematic(schematic)
+{
+}
+
+SchematicSnapshotBuilder::~SchematicSnapshotBuilder() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+GraphicsSnapshot SchematicSnapshotBuilder::build() const noexcept
+{
+    GraphicsSnapshot snapshot;
+
+    // same order as the Z values of the graphics items
+    foreach (const SI_Symbol* symbol, mSchematic.getSymbols()) { Q_ASSERT(symbol);
+        drawSymbol(snapshot, *symbol);
+    }
+    foreach (const SI_NetSegment* netsegment, mSchematic.getNetSegments()) { Q_ASSERT(netsegment);
+        drawNetSegment(snapshot, *netsegment);
+    }
+
+    return snapshot;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void SchematicSnapshotBuilder::drawSymbol(GraphicsSnapshot& snapshot,
+                                          const SI_Symbol& symbol) const noexcept
+{
+    const library::Symbol& libSymbol = symbol.getLibSymbol();
+    const QTransform transform = QTransform().rotate(-symbol.getRotation().toDeg())
+        * QTransform::fromTranslate(symbol.getPosition().toPxQPointF().x(),
+                                    symbol.getPosition().toPxQPointF().y());
+    const GraphicsLayer* grabAreaLayer = getVisibleLayer(GraphicsLayer::sSymbolGrabAreas);
+
+    // draw polygons
+    for (const Polygon& polygon : libSymbol.getPolygons()) {
+        const GraphicsLayer* layer = getVisibleLayer(*polygon.getLayerName());
+        QPen pen = layer ? QPen(layer->getColor(), polygon.getLineWidth()->toPx(),
+                                Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin) : QPen(Qt::NoPen);
+        QBrush brush;
+        if (polygon.isFilled() && layer) {
+            brush = QBrush(layer->getColor(), Qt::SolidPattern);
+        } else if (polygon.isGrabArea() && grabAreaLayer) {
+            brush = QBrush(grabAreaLayer->getColor(), Qt::SolidPattern);
+        }
+        snapshot.drawPath(polygon.getPath().toQPainterPathPx(), pen, brush, transform);
+    }
+
+    // draw circles
+    for (const Circle& circle : libSymbol.getCircles()) {
+        const GraphicsLayer* layer = getVisibleLayer(*circle.getLayerName());
+        QPen pen = layer ? QPen(layer->getColor(), circle.getLineWidth()->toPx(),
+                                Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin) : QPen(Qt::NoPen);
+        QBrush brush;
+        if (circle.isFilled() && layer) {
+            brush = QBrush(layer->getColor(), Qt::SolidPattern);
+        } else if (circle.isGrabArea() && grabAreaLayer) {
+            brush = QBrush(grabAreaLayer->getColor(), Qt::SolidPattern);
+        }
+        qreal radius = circle.getDiameter()->toPx() / 2;
+        snapshot.drawEllipse(circle.getCenter().toPxQPointF(), radius, radius, pen, brush,
+                             transform);
+    }
+
+    // draw texts (same layout as librepcb::project::SGI_Symbol)
+    QFont font = qApp->getDefaultSansSerifFont();
+    for (const Text& text : libSymbol.getTexts()) {
+        const GraphicsLayer* layer = getVisibleLayer(*text.getLayerName());
+        if (!layer) continue;
+
+        QString str = AttributeSubstitutor::substitute(text.getText(), &symbol);
+        font.setPixelSize(qCeil(text.getHeight()->toPx()));
+        QFontMetricsF metrics(font);
+        qreal scaleFactor = text.getHeight()->toPx() / metrics.height();
+        QRectF textRect = metrics.boundingRect(QRectF(), text.getAlign().toQtAlign() |
+                                               Qt::TextDontClip, str);
+        QRectF scaledTextRect = QRectF(textRect.topLeft() * scaleFactor,
+                                       textRect.bottomRight() * scaleFactor);
+        scaledTextRect.translate(text.getPosition().toPxQPointF());
+        textRect = QRectF(scaledTextRect.topLeft() / scaleFactor,
+                          scaledTextRect.bottomRight() / scaleFactor);
+
+        Angle absAngle = text.getRotation() + symbol.getRotation();
+        absAngle.mapTo180deg();
+        bool rotate180 = (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
+        int flags = rotate180 ? text.getAlign().mirrored().toQtAlign()
+                              : text.getAlign().toQtAlign();
+        if (rotate180) {
+            textRect = QRectF(-textRect.x(), -textRect.y(),
+                              -textRect.width(), -textRect.height()).normalized();
+        }
+
+        QTransform t;
+        t.translate(text.getPosition().toPxQPointF().x(), text.getPosition().toPxQPointF().y());
+        t.rotate(-text.getRotation().toDeg());
+        t.translate(-text.getPosition().toPxQPointF().x(), -text.getPosition().toPxQPointF().y());
+        t.scale(scaleFactor, scaleFactor);
+        if (rotate180) t.rotate(180);
+        snapshot.drawText(textRect, flags, str, font, layer->getColor(), t * transform);
+    }
+
+    // draw pins
+    foreach (const SI_SymbolPin* pin, symbol.getPins()) { Q_ASSERT(pin);
+        drawSymbolPin(snapshot, *pin);
+    }
+}
+
+void SchematicSnapshotBuilder::drawSymbolPin(GraphicsSnapshot& snapshot,
+                                             const SI_SymbolPin& pin) const noexcept
+{
+    Angle absAngle = pin.getLibPin().getRotation() + pin.getSymbol().getRotation();
+    const QTransform transform = QTransform().rotate(-absAngle.toDeg())
+        * QTransform::fromTranslate(pin.getPosition().toPxQPointF().x(),
+                                    pin.getPosition().toPxQPointF().y());
+
+    // draw line
+    const qreal lengthPx = pin.getLibPin().getLength()->toPx();
+    if (const GraphicsLayer* layer = getVisibleLayer(GraphicsLayer::sSymbolOutlines)) {
+        snapshot.drawLine(QLineF(0, 0, lengthPx, 0), QPen(layer->getColor(),
+                          SGI_SymbolPin::getLineWidth()->toPx(), Qt::SolidLine, Qt::RoundCap),
+                          transform);
+    }
+
+    // draw text (same layout as librepcb::project::SGI_SymbolPin)
+    if (const GraphicsLayer* layer = getVisibleLayer(GraphicsLayer::sSymbolPinNames)) {
+        QFont font = SGI_SymbolPin::getTextFont();
+        QString text = pin.getDisplayText();
+        QFontMetricsF metrics(font);
+        QSizeF size(metrics.width(text), metrics.height());
+        absAngle.mapTo180deg();
+        bool rotate180 = (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
+        qreal x = lengthPx + SGI_SymbolPin::getTextSpacingPx();
+        QPointF origin(rotate180 ? -x - size.width() : x, -size.height() / 2);
+        QTransform t = rotate180 ? QTransform().rotate(180) : QTransform();
+        snapshot.drawText(QRectF(origin, size), Qt::AlignLeft | Qt::AlignTop | Qt::TextDontClip,
+                          text, font, layer->getColor(), t * transform);
+    }
+}
+
+void SchematicSnapshotBuilder::drawNetSegment(GraphicsSnapshot& snapshot,
+                                              const SI_NetSegment& netsegment) const noexcept
+{
+    // draw net lines
+    if (const GraphicsLayer* layer = getVisibleLayer(GraphicsLayer::sSchematicNetLines)) {
+        foreach (const SI_NetLine* netline, netsegment.getNetLines()) { Q_ASSERT(netline);
+            snapshot.drawLine(QLineF(netline->getStartPoint().getPosition().toPxQPointF(),
+                                     netline->getEndPoint().getPosition().toPxQPointF()),
+                              QPen(layer->getColor(), netline->getWidth()->toPx(),
+                                   Qt::SolidLine, Qt::RoundCap));
+        }
+    }
+
+    // draw junctions
+    if (const GraphicsLayer* layer = getVisibleLayer(GraphicsLayer::sSchematicNetLines)) {
+        qreal radius = SGI_NetPoint::getJunctionRadius()->toPx();
+        foreach (const SI_NetPoint* netpoint, netsegment.getNetPoints()) { Q_ASSERT(netpoint);
+            if (netpoint->isVisibleJunction()) {
+                snapshot.drawEllipse(netpoint->getPosition().toPxQPointF(), radius, radius,
+                                     Qt::NoPen, QBrush(layer->getColor(), Qt::SolidPattern));
+            }
+        }
+    }
+
+    // draw net labels (same layout as librepcb::project::SGI_NetLabel)
+    if (const GraphicsLayer* layer = getVisibleLayer(GraphicsLayer::sSchematicNetLabels)) {
+        QFont font = SGI_NetLabel::getFont();
+        QFontMetricsF metrics(font);
+        foreach (const SI_NetLabel* netlabel, netsegment.getNetLabels()) { Q_ASSERT(netlabel);
+            QString text = *netlabel->getNetSignalOfNetSegment().getName();
+            QSizeF size(metrics.width(text), metrics.height());
+            Angle rotation = netlabel->getRotation().mappedTo180deg();
+            bool rotate180 = (rotation <= -Angle::deg90() || rotation > Angle::deg90());
+            QPointF origin(rotate180 ? -size.width() : 0, rotate180 ? 0 : -size.height());
+            QTransform t = rotate180 ? QTransform().rotate(180) : QTransform();
+            t *= QTransform().rotate(-netlabel->getRotation().toDeg());
+            t *= QTransform::fromTranslate(netlabel->getPosition().toPxQPointF().x(),
+                                           netlabel->getPosition().toPxQPointF().y());
+            snapshot.drawText(QRectF(origin, size), Qt::AlignLeft | Qt::AlignTop |
+                              Qt::TextDontClip, text, font, layer->getColor(), t);
+        }
+    }
+}
+
+const GraphicsLayer* SchematicSnapshotBuilder::getVisibleLayer(const QString& name) const noexcept
+{
+    const GraphicsLayer* layer = mSchematic.getProject().getLayers().getLayer(name);
+    return (layer && layer->isVisible()) ? layer : nullptr;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
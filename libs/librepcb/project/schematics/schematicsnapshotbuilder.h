@@ -0,0 +1,94 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_SCHEMATICSNAPSHOTBUILDER_H
+#define LIBREPCB_PROJECT_SCHEMATICSNAPSHOTBUILDER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include <librepcb/common/graphics/graphicssnapshot.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class GraphicsLayer;
+
+namespace project {
+
+class Schematic;
+class SI_Symbol;
+class SI_SymbolPin;
+class SI_NetSegment;
+
+/*****************************************************************************************
+ *  Class SchematicSnapshotBuilder
+ ****************************************************************************************/
+
+/**
+ * @brief Records a schematic page into a librepcb::GraphicsSnapshot
+ *
+ * The content is taken directly from the schematic items, so the graphics items and the
+ * graphics scene of the schematic are not involved at all. The output is the same as
+ * when printing the schematic, i.e. only visible layers are recorded and elements which
+ * are only useful in the editor (like origin crosses) are omitted.
+ *
+ * The snapshot must be built in the thread the schematic lives in, but can then be
+ * rendered in any thread.
+ */
+class SchematicSnapshotBuilder final
+{
+    public:
+
+        // Constructors / Destructor
+        SchematicSnapshotBuilder() = delete;
+        SchematicSnapshotBuilder(const SchematicSnapshotBuilder& other) = delete;
+        explicit SchematicSnapshotBuilder(const Schematic& schematic) noexcept;
+        ~SchematicSnapshotBuilder() noexcept;
+
+        // General Methods
+        GraphicsSnapshot build() const noexcept;
+
+        // Operator Overloadings
+        SchematicSnapshotBuilder& operator=(const SchematicSnapshotBuilder& rhs) = delete;
+
+
+    private: // Methods
+        void drawSymbol(GraphicsSnapshot& snapshot, const SI_Symbol& symbol) const noexcept;
+        void drawSymbolPin(GraphicsSnapshot& snapshot, const SI_SymbolPin& pin) const noexcept;
+        void drawNetSegment(GraphicsSnapshot& snapshot, const SI_NetSegment& netsegment) const noexcept;
+        const GraphicsLayer* getVisibleLayer(const QString& name) const noexcept;
+
+
+    private: // Data
+        const Schematic& mSchematic;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_SCHEMATICSNAPSHOTBUILDER_H
@@ -33,6 +33,7 @@
 #include <librepcb/common/utils/undostackactiongroup.h>
 #include <librepcb/common/utils/exclusiveactiongroup.h>
 #include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
 #include <librepcb/project/boards/items/bi_plane.h>
 #include <librepcb/project/circuit/circuit.h>
 #include <librepcb/common/dialogs/aboutdialog.h>
@@ -96,6 +97,7 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project) :
     // add graphics view as central widget
     mGraphicsView = new GraphicsView(nullptr, this);
     mGraphicsView->setUseOpenGl(mProjectEditor.getWorkspace().getSettings().getAppearance().getUseOpenGl());
+    mGraphicsView->setUseTileCache(true);
     mGraphicsView->setBackgroundBrush(Qt::black);
     mGraphicsView->setForegroundBrush(Qt::white);
     //setCentralWidget(mGraphicsView);
@@ -251,6 +253,7 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept
     {
         // show scene, restore view scene rect, set grid properties
         board->showInView(*mGraphicsView);
+        mGraphicsView->setObservedLayers(board->getLayerStack().getAllLayers());
         mGraphicsView->setVisibleSceneRect(board->restoreViewSceneRect());
         mGraphicsView->setGridProperties(board->getGridProperties());
         // force airwire rebuild immediately and on every project modification
@@ -264,6 +267,7 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept
     else
     {
         mGraphicsView->setScene(nullptr);
+        mGraphicsView->setObservedLayers({});
     }
 
     // active board has changed!
@@ -309,6 +313,9 @@ void BoardEditor::boardAdded(int newIndex)
     Board* board = mProject.getBoardByIndex(newIndex);
     Q_ASSERT(board); if (!board) return;
 
+    // draw the net lines in batches to keep the number of graphics items small
+    board->setNetLineBatchingEnabled(true);
+
     QAction* actionBefore = mBoardListActions.value(newIndex-1);
     //if (!actionBefore) actionBefore = TODO
     QAction* newAction = new QAction(*board->getName(), this);
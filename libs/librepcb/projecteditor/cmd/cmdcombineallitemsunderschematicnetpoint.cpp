@@ -156,8 +156,8 @@ bool CmdCombineAllItemsUnderSchematicNetPoint::performExecute()
     }
 
     // combine with netpoints & netlines of the same netsegment under the cursor
-    netpointsUnderCursor.clear();
-    resultingNetSegment.getNetPointsAtScenePos(mNetPoint.getPosition(), netpointsUnderCursor);
+    netpointsUnderCursor = mSchematic.getNetPointsAtScenePos(mNetPoint.getPosition(),
+                                                             &resultingNetSegment);
     netpointsUnderCursor.removeOne(&mNetPoint);
     if (netpointsUnderCursor.count() > 0) {
         foreach (SI_NetPoint* netpoint, netpointsUnderCursor) {
@@ -165,8 +165,8 @@ bool CmdCombineAllItemsUnderSchematicNetPoint::performExecute()
             mHasCombinedSomeItems = true;
         }
     } else {
-        netlinesUnderCursor.clear();
-        resultingNetSegment.getNetLinesAtScenePos(mNetPoint.getPosition(), netlinesUnderCursor);
+        netlinesUnderCursor = mSchematic.getNetLinesAtScenePos(mNetPoint.getPosition(),
+                                                               &resultingNetSegment);
         QList<SI_NetLine*> netlinesOfNetpoint = mNetPoint.getLines();
         foreach (SI_NetLine* netline, netlinesUnderCursor) {
             if (!netlinesOfNetpoint.contains(netline)) {
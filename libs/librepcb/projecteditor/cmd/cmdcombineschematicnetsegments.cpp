@@ -24,6 +24,7 @@
 #include "cmdcombineschematicnetsegments.h"
 #include <librepcb/common/scopeguard.h>
 #include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/schematics/schematic.h>
 #include <librepcb/project/schematics/items/si_netsegment.h>
 #include <librepcb/project/schematics/items/si_netpoint.h>
 #include <librepcb/project/schematics/items/si_netline.h>
@@ -72,14 +73,15 @@ bool CmdCombineSchematicNetSegments::performExecute()
         throw LogicError(__FILE__, __LINE__);
 
     // find all interception netpoints
-    QList<SI_NetPoint*> netpointsUnderJunction;
-    mNetSegmentToBeRemoved.getNetPointsAtScenePos(mJunctionNetPoint.getPosition(), netpointsUnderJunction);
+    Schematic& schematic = mNetSegmentToBeRemoved.getSchematic();
+    QList<SI_NetPoint*> netpointsUnderJunction = schematic.getNetPointsAtScenePos(
+        mJunctionNetPoint.getPosition(), &mNetSegmentToBeRemoved);
 
     // create exactly one interception netpoint
     SI_NetPoint* interceptionNetPoint = nullptr;
     if (netpointsUnderJunction.count() == 0) {
-        QList<SI_NetLine*> netlinesUnderJunction;
-        mNetSegmentToBeRemoved.getNetLinesAtScenePos(mJunctionNetPoint.getPosition(), netlinesUnderJunction);
+        QList<SI_NetLine*> netlinesUnderJunction = schematic.getNetLinesAtScenePos(
+            mJunctionNetPoint.getPosition(), &mNetSegmentToBeRemoved);
         if (netlinesUnderJunction.count() == 0) {
             throw LogicError(__FILE__, __LINE__);
         } else {
@@ -108,6 +108,7 @@ ErcMsgDock::ErcMsgDock(Project& project) :
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgAdded,    this, &ErcMsgDock::ercMsgAdded);
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgRemoved,  this, &ErcMsgDock::ercMsgRemoved);
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgChanged,  this, &ErcMsgDock::ercMsgChanged);
+    connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgsChanged, this, &ErcMsgDock::ercMsgsChanged);
 
     updateTopLevelItemTexts();
 }
@@ -133,9 +134,8 @@ void ErcMsgDock::ercMsgAdded(ErcMsg* ercMsg) noexcept
     Q_ASSERT(parent); if (!parent) return;
     QTreeWidgetItem* child = new QTreeWidgetItem(parent, QStringList(ercMsg->getMsg()));
     child->setToolTip(0, ercMsg->getMsg());
-    parent->sortChildren(0, Qt::AscendingOrder);
     mErcMsgItems.insert(ercMsg, child);
-    updateTopLevelItemTexts();
+    // sorting and updating the counters is done once per batch in ercMsgsChanged()
 }
 
 void ErcMsgDock::ercMsgRemoved(ErcMsg* ercMsg) noexcept
@@ -143,7 +143,6 @@ void ErcMsgDock::ercMsgRemoved(ErcMsg* ercMsg) noexcept
     Q_ASSERT(ercMsg);
     Q_ASSERT(mErcMsgItems.contains(ercMsg));
     delete mErcMsgItems.take(ercMsg);
-    updateTopLevelItemTexts();
 }
 
 void ErcMsgDock::ercMsgChanged(ErcMsg* ercMsg) noexcept
@@ -152,6 +151,14 @@ void ErcMsgDock::ercMsgChanged(ErcMsg* ercMsg) noexcept
     ercMsgAdded(ercMsg);
 }
 
+void ErcMsgDock::ercMsgsChanged() noexcept
+{
+    foreach (QTreeWidgetItem* item, mTopLevelItems) {
+        item->sortChildren(0, Qt::AscendingOrder);
+    }
+    updateTopLevelItemTexts();
+}
+
 /*****************************************************************************************
  *  GUI Actions
  ****************************************************************************************/
@@ -65,6 +65,7 @@ class ErcMsgDock final : public QDockWidget
         void ercMsgAdded(ErcMsg* ercMsg) noexcept;
         void ercMsgRemoved(ErcMsg* ercMsg) noexcept;
         void ercMsgChanged(ErcMsg* ercMsg) noexcept;
+        void ercMsgsChanged() noexcept;
 
 
     private slots:
@@ -21,11 +21,13 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "projecteditor.h"
 #include <librepcb/common/undostack.h>
 #include <librepcb/workspace/workspace.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/project/project.h>
+#include <librepcb/project/erc/ercmsglist.h>
 #include "schematiceditor/schematiceditor.h"
 #include "boardeditor/boardeditor.h"
 #include "dialogs/projectsettingsdialog.h"
@@ -63,20 +65,28 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
         throw; // ...and rethrow the exception
     }
 
+    // update the ERC messages as soon as a command group is finished
+    connect(mUndoStack, &UndoStack::commandGroupEnded,
+            &mProject.getErcMsgList(), &ErcMsgList::processScheduledUpdates);
+
     // setup the timer for automatic backups, if enabled in the settings
     int intervalSecs =  mWorkspace.getSettings().getProjectAutosaveInterval().getInterval();
     if ((intervalSecs > 0) && (!project.isReadOnly()))
     {
         // autosaving is enabled --> start the timer
         connect(&mAutoSaveTimer, &QTimer::timeout, this, &ProjectEditor::autosaveProject);
+        connect(&mAutosaveWatcher, &QFutureWatcher<QStringList>::finished,
+                this, &ProjectEditor::autosaveFinished);
         mAutoSaveTimer.start(1000 * intervalSecs);
     }
 }
 
 ProjectEditor::~ProjectEditor() noexcept
 {
-    // stop the autosave timer
+    // stop the autosave timer and wait until the temporary files are written, as the
+    // project (which removes its temporary files) will be destroyed afterwards
     mAutoSaveTimer.stop();
+    mAutosaveWatcher.waitForFinished();
 
     // abort all active commands!
     mSchematicEditor->abortAllCommands();
@@ -157,6 +167,9 @@ void ProjectEditor::execNetClassesEditorDialog(QWidget* parent) noexcept
 
 bool ProjectEditor::saveProject() noexcept
 {
+    // an autosave must not write temporary files while the project is being saved
+    mAutosaveWatcher.waitForFinished();
+
     try
     {
         // step 1: save whole project to temporary files
@@ -196,19 +209,48 @@ bool ProjectEditor::autosaveProject() noexcept
         return false;
     }
 
+    if (mAutosaveWatcher.isRunning())
+    {
+        // the previous autosave is still writing files, so do not queue up another one
+        // but try it a few seconds later instead...
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
+        QTimer::singleShot(10000, this, &ProjectEditor::autosaveProject);
+#else
+        QTimer::singleShot(10000, this, SLOT(autosaveProject()));
+#endif
+        return false;
+    }
+
     try
     {
+        // serialize the project in this thread (fast), but format and write the
+        // temporary files in a worker thread to not block the GUI (slow)
         qDebug() << "Begin autosaving the project to temporary files...";
-        mProject.save(false);
-        qDebug() << "Project successfully autosaved";
+        FileWriteBatch batch = mProject.createTemporarySaveBatch(); // can throw
+        mAutosaveWatcher.setFuture(QtConcurrent::run([batch]() -> QStringList {
+            QStringList errors;
+            batch.execute(errors);
+            return errors;
+        }));
         return true;
     }
     catch (Exception& exc)
     {
+        qWarning() << "Failed to autosave the project:" << exc.getMsg();
         return false;
     }
 }
 
+void ProjectEditor::autosaveFinished() noexcept
+{
+    QStringList errors = mAutosaveWatcher.result();
+    if (errors.isEmpty()) {
+        qDebug() << "Project successfully autosaved";
+    } else {
+        qWarning() << "Failed to autosave the project:" << errors.join("; ");
+    }
+}
+
 bool ProjectEditor::closeAndDestroy(bool askForSave, QWidget* msgBoxParent) noexcept
 {
     if (((!mProject.isRestored()) && (mUndoStack->isClean())) || (mProject.isReadOnly()) || (!askForSave))
@@ -24,6 +24,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QFutureWatcher>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/attributes/attributeprovider.h>
 #include <librepcb/common/exceptions.h>
@@ -167,9 +168,13 @@ class ProjectEditor final : public QObject
         /**
          * @brief Make a automatic backup of the project (save to temporary files)
          *
+         * The project is serialized immediately, but the temporary files are written in
+         * a worker thread. If the previous autosave is still writing, no new one is
+         * started but it is retried a few seconds later.
+         *
          * @note The whole save procedere is described in @ref doc_project_save.
          *
-         * @return true on success, false on failure
+         * @return true if the autosave was started, false if not or on failure
          */
         bool autosaveProject() noexcept;
 
@@ -208,6 +213,7 @@ class ProjectEditor final : public QObject
     private: // Methods
 
         int getCountOfVisibleEditorWindows() const noexcept;
+        void autosaveFinished() noexcept;
 
 
     private: // Data
@@ -215,6 +221,7 @@ class ProjectEditor final : public QObject
         workspace::Workspace& mWorkspace;
         Project& mProject;
         QTimer mAutoSaveTimer; ///< the timer for the periodically automatic saving functionality (see also @ref doc_project_save)
+        QFutureWatcher<QStringList> mAutosaveWatcher; ///< writes the temporary files of the running autosave (returns the errors)
         UndoStack* mUndoStack; ///< See @ref doc_project_undostack
         SchematicEditor* mSchematicEditor; ///< The schematic editor (GUI)
         BoardEditor* mBoardEditor; ///< The board editor (GUI)
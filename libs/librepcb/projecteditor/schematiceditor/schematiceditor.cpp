@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
 #include "schematiceditor.h"
 #include "ui_schematiceditor.h"
 #include <librepcb/project/project.h>
@@ -34,6 +35,7 @@
 #include <librepcb/common/utils/undostackactiongroup.h>
 #include <librepcb/common/utils/exclusiveactiongroup.h>
 #include <librepcb/project/schematics/schematic.h>
+#include <librepcb/project/schematics/schematicpdfexport.h>
 #include "schematicpagesdock.h"
 #include "../docks/ercmsgdock.h"
 #include "fsm/ses_fsm.h"
@@ -322,8 +324,46 @@ void SchematicEditor::on_actionPDF_Export_triggered()
         if (filename.isEmpty()) return;
         if (!filename.endsWith(".pdf")) filename.append(".pdf");
         FilePath filepath(filename);
-        mProject.exportSchematicsAsPdf(filepath); // this method can throw an exception
-        QDesktopServices::openUrl(QUrl::fromLocalFile(filepath.toStr()));
+
+        // record all pages now, but write the PDF in a worker thread to not block the GUI
+        QList<int> pages;
+        for (int i = 0; i < mProject.getSchematics().count(); ++i) pages.append(i);
+        QSharedPointer<SchematicPdfExport> pdfExport(
+            new SchematicPdfExport(mProject, pages), &QObject::deleteLater); // can throw
+
+        QProgressDialog* dialog = new QProgressDialog(tr("Exporting schematics..."),
+            tr("Cancel"), 0, pdfExport->getPageCount(), this);
+        dialog->setWindowTitle(tr("PDF Export"));
+        dialog->setWindowModality(Qt::WindowModal);
+        dialog->setMinimumDuration(500);
+        connect(pdfExport.data(), &SchematicPdfExport::progress,
+                dialog, &QProgressDialog::setValue);
+        connect(dialog, &QProgressDialog::canceled,
+                pdfExport.data(), &SchematicPdfExport::cancel);
+
+        QFutureWatcher<QString>* watcher = new QFutureWatcher<QString>(dialog);
+        connect(watcher, &QFutureWatcher<QString>::finished,
+                [this, pdfExport, watcher, dialog, filepath]() {
+            QString error = watcher->result();
+            dialog->deleteLater();
+            if (pdfExport->isCanceled()) {
+                // nothing to do
+            } else if (error.isEmpty()) {
+                QDesktopServices::openUrl(QUrl::fromLocalFile(filepath.toStr()));
+            } else {
+                QMessageBox::warning(this, tr("Error"), error);
+            }
+        });
+        watcher->setFuture(QtConcurrent::run([pdfExport, filepath]() -> QString {
+            try {
+                pdfExport->exportPdf(filepath); // can throw
+                return QString();
+            } catch (const UserCanceled&) {
+                return QString();
+            } catch (const Exception& e) {
+                return e.getMsg();
+            }
+        }));
     }
     catch (Exception& e)
     {
@@ -22,7 +22,6 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "categorytreeitem.h"
-#include "../workspacelibrarydb.h"
 #include <librepcb/library/cat/componentcategory.h>
 #include <librepcb/library/cat/packagecategory.h>
 
@@ -40,39 +39,39 @@ using namespace library;
 
 template <typename ElementType>
 CategoryTreeItem<ElementType>::CategoryTreeItem(const WorkspaceLibraryDb& library,
-        const QStringList localeOrder, CategoryTreeItem* parent, const tl::optional<Uuid>& uuid) noexcept :
-    mLocaleOrder(localeOrder), mParent(parent), mUuid(uuid),
-    mDepth(parent ? parent->getDepth() + 1 : 0), mExceptionMessage()
+        const QStringList& localeOrder) noexcept :
+    mParent(nullptr), mUuid(tl::nullopt), mDepth(0), mExceptionMessage()
 {
     try {
-        if (mUuid) {
-            FilePath fp = getLatestCategory(library);
-            if (fp.isValid()) mCategory.reset(new ElementType(fp, true));
+        // fetch all categories at once and index them by their parent
+        const QList<Metadata> categories = getAllCategories(library, localeOrder); // can throw
+        MetadataChildsMap childs;
+        for (const Metadata& category : categories) {
+            childs.insert(category.parent ? category.parent->toStr() : QString(), &category);
         }
+        addChilds(childs);
 
-        if (mUuid || (!mParent)) {
-            QSet<Uuid> childs = getCategoryChilds(library);
-            foreach (const Uuid& childUuid, childs) {
-                ChildType child(new CategoryTreeItem(library, mLocaleOrder, this, childUuid));
-                mChilds.append(child);
-            }
-
-            // sort childs
-            qSort(mChilds.begin(), mChilds.end(),
-                  [](const ChildType& a, const ChildType& b)
-                  {return a->data(Qt::DisplayRole) < b->data(Qt::DisplayRole);});
-        }
-
-        if (!mParent) {
-            // add category for elements without category
-            ChildType child(new CategoryTreeItem(library, mLocaleOrder, this, tl::nullopt));
-            mChilds.append(child);
-        }
+        // add category for elements without category
+        ChildType child(new CategoryTreeItem(this, nullptr, MetadataChildsMap()));
+        mChilds.append(child);
     } catch (const Exception& e) {
         mExceptionMessage = e.getMsg();
     }
 }
 
+template <typename ElementType>
+CategoryTreeItem<ElementType>::CategoryTreeItem(CategoryTreeItem* parent,
+        const Metadata* metadata, const MetadataChildsMap& childs) noexcept :
+    mParent(parent), mUuid(metadata ? tl::make_optional(metadata->uuid) : tl::nullopt),
+    mDepth(parent->getDepth() + 1), mExceptionMessage()
+{
+    if (metadata) {
+        mName = metadata->name;
+        mDescription = metadata->description;
+        addChilds(childs);
+    }
+}
+
 template <typename ElementType>
 CategoryTreeItem<ElementType>::~CategoryTreeItem() noexcept
 {
@@ -105,10 +104,8 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept
         case Qt::DisplayRole:
             if (!mUuid)
                 return "(Without Category)";
-            else if (mCategory)
-                return *mCategory->getNames().value(mLocaleOrder);
             else
-                return "(ERROR)";
+                return mName;
 
         case Qt::DecorationRole:
             break;
@@ -119,11 +116,9 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept
         case Qt::StatusTipRole:
         case Qt::ToolTipRole:
             if (!mUuid)
-                return "All library elements without a category";
-            else if (mCategory)
-                return mCategory->getDescriptions().value(mLocaleOrder);
+                return mParent ? "All library elements without a category" : mExceptionMessage;
             else
-                return mExceptionMessage;
+                return mDescription;
 
         case Qt::UserRole:
             return mUuid ? mUuid->toStr() : QString();
@@ -138,28 +133,32 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept
  *  Private Methods
  ****************************************************************************************/
 
-template <>
-FilePath CategoryTreeItem<ComponentCategory>::getLatestCategory(const WorkspaceLibraryDb& lib) const
+template <typename ElementType>
+void CategoryTreeItem<ElementType>::addChilds(const MetadataChildsMap& childs) noexcept
 {
-    return lib.getLatestComponentCategory(*mUuid);
-}
+    foreach (const Metadata* metadata, childs.values(mUuid ? mUuid->toStr() : QString())) {
+        ChildType child(new CategoryTreeItem(this, metadata, childs));
+        mChilds.append(child);
+    }
 
-template <>
-FilePath CategoryTreeItem<PackageCategory>::getLatestCategory(const WorkspaceLibraryDb& lib) const
-{
-    return lib.getLatestPackageCategory(*mUuid);
+    // sort childs
+    qSort(mChilds.begin(), mChilds.end(),
+          [](const ChildType& a, const ChildType& b)
+          {return a->data(Qt::DisplayRole) < b->data(Qt::DisplayRole);});
 }
 
 template <>
-QSet<Uuid> CategoryTreeItem<ComponentCategory>::getCategoryChilds(const WorkspaceLibraryDb& lib) const
+QList<WorkspaceLibraryDb::CategoryMetadata> CategoryTreeItem<ComponentCategory>::getAllCategories(
+    const WorkspaceLibraryDb& lib, const QStringList& localeOrder) const
 {
-    return lib.getComponentCategoryChilds(mUuid);
+    return lib.getAllComponentCategories(localeOrder);
 }
 
 template <>
-QSet<Uuid> CategoryTreeItem<PackageCategory>::getCategoryChilds(const WorkspaceLibraryDb& lib) const
+QList<WorkspaceLibraryDb::CategoryMetadata> CategoryTreeItem<PackageCategory>::getAllCategories(
+    const WorkspaceLibraryDb& lib, const QStringList& localeOrder) const
 {
-    return lib.getPackageCategoryChilds(mUuid);
+    return lib.getAllPackageCategories(localeOrder);
 }
 
 /*****************************************************************************************
@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/uuid.h>
+#include "../workspacelibrarydb.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -38,14 +39,15 @@ class PackageCategory;
 
 namespace workspace {
 
-class WorkspaceLibraryDb;
-
 /*****************************************************************************************
  *  Class CategoryTreeItem
  ****************************************************************************************/
 
 /**
  * @brief The CategoryTreeItem class
+ *
+ * The whole tree is built from the category metadata stored in the workspace library
+ * database (fetched with a single query), i.e. no category element files are opened.
  */
 template <typename ElementType>
 class CategoryTreeItem final
@@ -55,8 +57,7 @@ class CategoryTreeItem final
         // Constructors / Destructor
         CategoryTreeItem() = delete;
         CategoryTreeItem(const CategoryTreeItem& other) = delete;
-        CategoryTreeItem(const WorkspaceLibraryDb& library, const QStringList localeOrder,
-                         CategoryTreeItem* parent, const tl::optional<Uuid>& uuid) noexcept;
+        CategoryTreeItem(const WorkspaceLibraryDb& library, const QStringList& localeOrder) noexcept;
         ~CategoryTreeItem() noexcept;
 
         // Getters
@@ -77,16 +78,23 @@ class CategoryTreeItem final
 
         // Types
         using ChildType = QSharedPointer<CategoryTreeItem<ElementType>>;
+        using Metadata = WorkspaceLibraryDb::CategoryMetadata;
+        using MetadataChildsMap = QMultiHash<QString, const Metadata*>; ///< key: parent UUID
+
+        // Constructors
+        CategoryTreeItem(CategoryTreeItem* parent, const Metadata* metadata,
+                         const MetadataChildsMap& childs) noexcept;
 
         // Methods
-        FilePath getLatestCategory(const WorkspaceLibraryDb& lib) const;
-        QSet<Uuid> getCategoryChilds(const WorkspaceLibraryDb& lib) const;
+        void addChilds(const MetadataChildsMap& childs) noexcept;
+        QList<Metadata> getAllCategories(const WorkspaceLibraryDb& lib,
+                                         const QStringList& localeOrder) const;
 
         // Attributes
-        QStringList mLocaleOrder;
         CategoryTreeItem* mParent;
         tl::optional<Uuid> mUuid;
-        QScopedPointer<ElementType> mCategory;
+        QString mName;
+        QString mDescription;
         unsigned int mDepth; ///< this is to avoid endless recursion in the parent-child relationship
         QString mExceptionMessage;
         QList<ChildType> mChilds;
@@ -22,6 +22,9 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtSql>
+#include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
+#include <librepcb/common/application.h>
 #include <librepcb/common/sqlitedatabase.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/smartsexprfile.h>
@@ -50,7 +53,9 @@ using namespace library;
  ****************************************************************************************/
 
 WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
-    QObject(nullptr), mWorkspace(ws)
+    QObject(nullptr), mWorkspace(ws), mScanGeneration(0), mFullRescanPending(false),
+    mElementFilesSweepIsCheck(false), mElementFilesBaselineSweepPending(false),
+    mElementFilesCheckSweepPending(false)
 {
     qDebug("Load workspace library database...");
 
@@ -71,6 +76,14 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
 
     // create library scanner object
     mLibraryScanner.reset(new WorkspaceLibraryScanner(mWorkspace));
+    // Note: These connections must be made before forwarding the scanner signals to
+    // ensure the cache is invalidated before any listener queries the database again.
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::succeeded,
+            this, &WorkspaceLibraryDb::libraryScanSucceeded, Qt::QueuedConnection);
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::elementsChanged,
+            this, &WorkspaceLibraryDb::libraryScanSucceeded, Qt::QueuedConnection);
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::finished,
+            this, &WorkspaceLibraryDb::libraryScannerFinished, Qt::QueuedConnection);
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::started,
             this, &WorkspaceLibraryDb::scanStarted, Qt::QueuedConnection);
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::progressUpdate,
@@ -79,6 +92,23 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
             this, &WorkspaceLibraryDb::scanSucceeded, Qt::QueuedConnection);
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::failed,
             this, &WorkspaceLibraryDb::scanFailed, Qt::QueuedConnection);
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::elementsChanged,
+            this, &WorkspaceLibraryDb::elementsChanged, Qt::QueuedConnection);
+
+    // watch the libraries for modifications made by external tools
+    mFileSystemWatcher.reset(new QFileSystemWatcher());
+    connect(mFileSystemWatcher.data(), &QFileSystemWatcher::directoryChanged,
+            this, &WorkspaceLibraryDb::watchedDirectoryChanged);
+    connect(qApp, &QGuiApplication::applicationStateChanged, this,
+            [this](Qt::ApplicationState state){
+                if (state == Qt::ApplicationActive) checkForModifiedElementFiles();});
+    connect(&mElementFilesSweepWatcher, &QFutureWatcher<QHash<FilePath, QDateTime>>::finished,
+            this, &WorkspaceLibraryDb::elementFilesSweepFinished);
+    mFileSystemChangesTimer.setSingleShot(true);
+    mFileSystemChangesTimer.setInterval(sFileSystemChangesDelayMs);
+    connect(&mFileSystemChangesTimer, &QTimer::timeout,
+            this, &WorkspaceLibraryDb::processFileSystemChanges);
+    updateWatchedDirectories();
 
     qDebug("Workspace library database successfully loaded!");
 }
@@ -336,19 +366,223 @@ QSet<Uuid> WorkspaceLibraryDb::getComponentsBySearchKeyword(const QString& keywo
     return elements;
 }
 
+QList<WorkspaceLibraryDb::CategoryMetadata> WorkspaceLibraryDb::getAllComponentCategories(
+    const QStringList& localeOrder) const
+{
+    return getAllCategories("component_categories", localeOrder);
+}
+
+QList<WorkspaceLibraryDb::CategoryMetadata> WorkspaceLibraryDb::getAllPackageCategories(
+    const QStringList& localeOrder) const
+{
+    return getAllCategories("package_categories", localeOrder);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
 void WorkspaceLibraryDb::startLibraryRescan() noexcept
 {
-    mLibraryScanner->start();
+    if (mLibraryScanner->isRunning()) {
+        mFullRescanPending = true; // will be started when the scanner has finished
+    } else {
+        mFullRescanPending = false;
+        mLibraryScanner->start();
+    }
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+void WorkspaceLibraryDb::libraryScanSucceeded() noexcept
+{
+    ++mScanGeneration;
+    updateWatchedDirectories();
+}
+
+void WorkspaceLibraryDb::libraryScannerFinished() noexcept
+{
+    if (mFullRescanPending) {
+        startLibraryRescan();
+    }
+}
+
+void WorkspaceLibraryDb::updateWatchedDirectories() noexcept
+{
+    // Only the libraries and their elements directories are watched, to get notified
+    // about added, removed or renamed libraries and elements. Watching every element
+    // directory would need thousands of watches (which are a limited resource on most
+    // systems) and still not report in-place modifications of element files, so these
+    // are detected with the modification times instead, see
+    // #checkForModifiedElementFiles().
+    QSet<QString> dirs;
+    dirs.insert(mWorkspace.getLibrariesPath().getPathTo("local").toStr());
+    dirs.insert(mWorkspace.getLibrariesPath().getPathTo("remote").toStr());
+    QList<QSharedPointer<Library>> libraries;
+    libraries.append(mWorkspace.getLocalLibraries().values());
+    libraries.append(mWorkspace.getRemoteLibraries().values());
+    foreach (const QSharedPointer<Library>& lib, libraries) {
+        dirs.insert(lib->getFilePath().toStr());
+        dirs.insert(lib->getElementsDirectory<ComponentCategory>().toStr());
+        dirs.insert(lib->getElementsDirectory<PackageCategory>().toStr());
+        dirs.insert(lib->getElementsDirectory<Symbol>().toStr());
+        dirs.insert(lib->getElementsDirectory<Package>().toStr());
+        dirs.insert(lib->getElementsDirectory<Component>().toStr());
+        dirs.insert(lib->getElementsDirectory<Device>().toStr());
+    }
+
+    // only add/remove the differences, (re)adding paths is expensive
+    QSet<QString> watchedDirs = mFileSystemWatcher->directories().toSet();
+    QStringList removedDirs = (watchedDirs - dirs).toList();
+    QStringList addedDirs;
+    foreach (const QString& dir, dirs - watchedDirs) {
+        if (QFileInfo(dir).isDir()) addedDirs.append(dir);
+    }
+    if (!removedDirs.isEmpty()) mFileSystemWatcher->removePaths(removedDirs);
+    if (!addedDirs.isEmpty()) mFileSystemWatcher->addPaths(addedDirs);
+
+    // remember all element files in the database, their modification times are then
+    // determined in a worker thread
+    mKnownElementDirs.clear();
+    mKnownElementFiles.clear();
+    try {
+        QList<QPair<QString, QString>> tables = {
+            {"component_categories", ComponentCategory::getLongElementName()},
+            {"package_categories", PackageCategory::getLongElementName()},
+            {"symbols", Symbol::getLongElementName()},
+            {"packages", Package::getLongElementName()},
+            {"components", Component::getLongElementName()},
+            {"devices", Device::getLongElementName()}};
+        foreach (const auto& table, tables) {
+            QSqlQuery query = mDb->prepareQuery("SELECT filepath FROM " % table.first);
+            mDb->exec(query); // can throw
+            while (query.next()) {
+                FilePath dir = FilePath::fromRelative(mWorkspace.getLibrariesPath(),
+                                                      query.value(0).toString());
+                mKnownElementDirs.insert(dir);
+                mKnownElementFiles.append(dir.getPathTo(table.second % ".lp"));
+            }
+        }
+    } catch (const Exception& e) {
+        qWarning() << "Could not determine library element files:" << e.getMsg();
+    }
+    mElementFileModifiedTimes.clear();
+    if (mElementFilesSweepWatcher.isRunning()) {
+        mElementFilesBaselineSweepPending = true;
+    } else {
+        mElementFilesSweepIsCheck = false;
+        startElementFilesSweep();
+    }
+}
+
+void WorkspaceLibraryDb::checkForModifiedElementFiles() noexcept
+{
+    if (mElementFilesSweepWatcher.isRunning()) {
+        mElementFilesCheckSweepPending = true;
+    } else if (!mElementFileModifiedTimes.isEmpty()) {
+        mElementFilesSweepIsCheck = true;
+        startElementFilesSweep();
+    }
+}
+
+void WorkspaceLibraryDb::startElementFilesSweep() noexcept
+{
+    QList<FilePath> files = mKnownElementFiles;
+    mElementFilesSweepWatcher.setFuture(QtConcurrent::run([files](){
+        return getModifiedTimes(files);}));
+}
+
+void WorkspaceLibraryDb::elementFilesSweepFinished() noexcept
+{
+    QHash<FilePath, QDateTime> times = mElementFilesSweepWatcher.result();
+    if (mElementFilesBaselineSweepPending) {
+        // the result is outdated since the elements were rescanned in the meantime
+        mElementFilesBaselineSweepPending = false;
+        mElementFilesSweepIsCheck = false;
+        startElementFilesSweep();
+        return;
+    }
+
+    if (mElementFilesSweepIsCheck) {
+        for (auto it = times.constBegin(); it != times.constEnd(); ++it) {
+            // a null QDateTime means the file does not exist (anymore)
+            if (mElementFileModifiedTimes.value(it.key()) != it.value()) {
+                mChangedDirectories.insert(it.key().getParentDir().toStr());
+            }
+        }
+        if (!mChangedDirectories.isEmpty()) {
+            mFileSystemChangesTimer.start();
+        }
+    }
+    mElementFileModifiedTimes = times;
+
+    if (mElementFilesCheckSweepPending) {
+        mElementFilesCheckSweepPending = false;
+        mElementFilesSweepIsCheck = true;
+        startElementFilesSweep();
+    }
+}
+
+void WorkspaceLibraryDb::watchedDirectoryChanged(const QString& path) noexcept
+{
+    mChangedDirectories.insert(path);
+    mFileSystemChangesTimer.start(); // restart to coalesce bursts of changes
+}
+
+void WorkspaceLibraryDb::processFileSystemChanges() noexcept
+{
+    if (mLibraryScanner->isRunning()) {
+        mFileSystemChangesTimer.start(); // try again later
+        return;
+    }
+
+    QSet<FilePath> elementDirs;
+    bool fullRescanRequired = false;
+    foreach (const QString& path, mChangedDirectories) {
+        FilePath dir(path);
+        if (isElementsDirectory(dir.getParentDir())) {
+            // files of an element were modified, or the element was removed
+            elementDirs.insert(dir);
+        } else if (isElementsDirectory(dir)) {
+            // elements were added, removed or renamed
+            QDir qdir(dir.toStr());
+            foreach (const QString& name, qdir.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+                FilePath elementDir = dir.getPathTo(name);
+                if (!mKnownElementDirs.contains(elementDir)) elementDirs.insert(elementDir);
+            }
+            foreach (const FilePath& elementDir, mKnownElementDirs) {
+                if ((elementDir.getParentDir() == dir) && (!elementDir.isExistingDir())) {
+                    elementDirs.insert(elementDir);
+                }
+            }
+        } else {
+            // libraries were added, removed or their files were replaced
+            fullRescanRequired = true;
+        }
+    }
+    mChangedDirectories.clear();
+
+    if (fullRescanRequired) {
+        startLibraryRescan();
+    } else if (!elementDirs.isEmpty()) {
+        bool started = mLibraryScanner->startPartialRescan(elementDirs);
+        Q_ASSERT(started); Q_UNUSED(started);
+    }
+}
+
+bool WorkspaceLibraryDb::isElementsDirectory(const FilePath& dir) const noexcept
+{
+    QStringList elementsDirNames = {
+        ComponentCategory::getShortElementName(), PackageCategory::getShortElementName(),
+        Symbol::getShortElementName(), Package::getShortElementName(),
+        Component::getShortElementName(), Device::getShortElementName()};
+    return elementsDirNames.contains(dir.getFilename())
+        && dir.isLocatedInDir(mWorkspace.getLibrariesPath())
+        && Library::isValidElementDirectory<Library>(dir.getParentDir());
+}
+
 void WorkspaceLibraryDb::getElementTranslations(const QString& table,
     const QString& idRow, const FilePath& elemDir, const QStringList& localeOrder,
     QString* name, QString* desc, QString* keywords) const
@@ -381,23 +615,33 @@ void WorkspaceLibraryDb::getElementTranslations(const QString& table,
 QMultiMap<Version, FilePath> WorkspaceLibraryDb::getElementFilePathsFromDb(
     const QString& tablename, const Uuid& uuid) const
 {
-    QSqlQuery query = mDb->prepareQuery(
-        "SELECT version, filepath FROM " % tablename % " WHERE uuid = :uuid");
-    query.bindValue(":uuid", uuid.toStr());
-    mDb->exec(query);
+    return getElementFilePathsCache(tablename).value(uuid); // can throw
+}
 
-    QMultiMap<Version, FilePath> elements;
-    while (query.next()) {
-        Version version = Version::fromString(query.value(0).toString()); // can throw
-        FilePath filepath(FilePath::fromRelative(mWorkspace.getLibrariesPath(),
-                                                 query.value(1).toString()));
-        if (filepath.isValid()) {
-            elements.insert(version, filepath);
-        } else {
-            throw LogicError(__FILE__, __LINE__);
+const QHash<Uuid, QMultiMap<Version, FilePath>>& WorkspaceLibraryDb::getElementFilePathsCache(
+    const QString& tablename) const
+{
+    if (mElementFilePathsCacheGenerations.value(tablename, -1) != mScanGeneration) {
+        QSqlQuery query = mDb->prepareQuery(
+            "SELECT uuid, version, filepath FROM " % tablename);
+        mDb->exec(query);
+
+        QHash<Uuid, QMultiMap<Version, FilePath>> elements;
+        while (query.next()) {
+            Uuid uuid = Uuid::fromString(query.value(0).toString()); // can throw
+            Version version = Version::fromString(query.value(1).toString()); // can throw
+            FilePath filepath(FilePath::fromRelative(mWorkspace.getLibrariesPath(),
+                                                     query.value(2).toString()));
+            if (filepath.isValid()) {
+                elements[uuid].insert(version, filepath);
+            } else {
+                throw LogicError(__FILE__, __LINE__);
+            }
         }
+        mElementFilePathsCache.insert(tablename, elements);
+        mElementFilePathsCacheGenerations.insert(tablename, mScanGeneration);
     }
-    return elements;
+    return mElementFilePathsCache[tablename];
 }
 
 FilePath WorkspaceLibraryDb::getLatestVersionFilePath(const QMultiMap<Version, FilePath>& list) const noexcept
@@ -437,6 +681,67 @@ QList<Uuid> WorkspaceLibraryDb::getCategoryParents(const QString& tablename, con
     return parentUuids;
 }
 
+QList<WorkspaceLibraryDb::CategoryMetadata> WorkspaceLibraryDb::getAllCategories(
+    const QString& tablename, const QStringList& localeOrder) const
+{
+    QSqlQuery query = mDb->prepareQuery(
+        "SELECT " % tablename % ".id, uuid, version, parent_uuid, locale, name, description "
+        "FROM " % tablename % " LEFT JOIN " % tablename % "_tr "
+        "ON " % tablename % ".id=" % tablename % "_tr.cat_id");
+    mDb->exec(query);
+
+    // there is one row per translation, so the element columns are repeated
+    QHash<Uuid, int> latestIds; // ID of the highest version of each UUID
+    QHash<int, Version> versions;
+    QHash<int, tl::optional<Uuid>> parents;
+    QHash<int, QHash<QString, QString>> names;
+    QHash<int, QHash<QString, QString>> descriptions;
+    while (query.next()) {
+        bool ok = false;
+        int id = query.value(0).toInt(&ok);
+        if (!ok) throw LogicError(__FILE__, __LINE__);
+        if (!versions.contains(id)) {
+            Uuid uuid = Uuid::fromString(query.value(1).toString()); // can throw
+            Version version = Version::fromString(query.value(2).toString()); // can throw
+            QVariant parent = query.value(3);
+            parents.insert(id, parent.isNull() ? tl::nullopt
+                : tl::make_optional(Uuid::fromString(parent.toString()))); // can throw
+            auto latest = latestIds.constFind(uuid);
+            if ((latest == latestIds.constEnd()) || (version > versions.value(*latest, version))) {
+                latestIds.insert(uuid, id);
+            }
+            versions.insert(id, version);
+        }
+        QString locale = query.value(4).toString();
+        QVariant name = query.value(5);
+        QVariant description = query.value(6);
+        if (!name.isNull())         names[id].insert(locale, name.toString());
+        if (!description.isNull())  descriptions[id].insert(locale, description.toString());
+    }
+
+    QList<CategoryMetadata> categories;
+    for (auto i = latestIds.constBegin(); i != latestIds.constEnd(); ++i) {
+        int id = i.value();
+        categories.append(CategoryMetadata{i.key(), parents.value(id),
+                                           getLocalizedValue(names.value(id), localeOrder),
+                                           getLocalizedValue(descriptions.value(id), localeOrder)});
+    }
+    return categories;
+}
+
+QString WorkspaceLibraryDb::getLocalizedValue(const QHash<QString, QString>& values,
+                                              const QStringList& localeOrder) noexcept
+{
+    // same lookup as SerializableKeyValueMap::value(), the empty locale is the default
+    foreach (const QString& locale, localeOrder) {
+        auto i = values.constFind(locale);
+        if (i != values.constEnd()) {
+            return *i;
+        }
+    }
+    return values.value(QString(""));
+}
+
 tl::optional<Uuid> WorkspaceLibraryDb::getCategoryParent(const QString& tablename, const Uuid& category) const
 {
     QSqlQuery query = mDb->prepareQuery(
@@ -710,6 +1015,16 @@ int WorkspaceLibraryDb::getDbVersion() const noexcept
     }
 }
 
+QHash<FilePath, QDateTime> WorkspaceLibraryDb::getModifiedTimes(
+    const QList<FilePath>& files) noexcept
+{
+    QHash<FilePath, QDateTime> times;
+    foreach (const FilePath& fp, files) {
+        times.insert(fp, QFileInfo(fp.toStr()).lastModified());
+    }
+    return times;
+}
+
 void WorkspaceLibraryDb::setDbVersion(int version)
 {
     QSqlQuery query = mDb->prepareQuery(
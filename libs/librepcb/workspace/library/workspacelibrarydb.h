@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <librepcb/common/uuid.h>
+#include <librepcb/common/version.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
 
@@ -33,7 +34,6 @@
  ****************************************************************************************/
 namespace librepcb {
 
-class Version;
 class SQLiteDatabase;
 
 namespace workspace {
@@ -54,6 +54,21 @@ class WorkspaceLibraryDb final : public QObject
 
     public:
 
+        // Types
+
+        /**
+         * @brief Metadata of a category, as stored in the database
+         *
+         * Contains everything needed to display a category in a tree, so the category
+         * element files don't need to be opened for that.
+         */
+        struct CategoryMetadata {
+            Uuid uuid;
+            tl::optional<Uuid> parent;
+            QString name;
+            QString description;
+        };
+
         // Constructors / Destructor
         WorkspaceLibraryDb() = delete;
         WorkspaceLibraryDb(const WorkspaceLibraryDb& other) = delete;
@@ -108,10 +123,25 @@ class WorkspaceLibraryDb final : public QObject
         QSet<Uuid> getDevicesOfComponent(const Uuid& component) const;
         QSet<Uuid> getComponentsBySearchKeyword(const QString& keyword) const;
 
+        /**
+         * @brief Get the metadata of all categories with a single database query
+         *
+         * Only the highest version of each category UUID is returned.
+         *
+         * @param localeOrder   The locale order used to select names and descriptions
+         *
+         * @return All categories (in arbitrary order)
+         */
+        QList<CategoryMetadata> getAllComponentCategories(const QStringList& localeOrder) const;
+        QList<CategoryMetadata> getAllPackageCategories(const QStringList& localeOrder) const;
+
         // General Methods
 
         /**
          * @brief Rescan the whole library directory and update the SQLite database
+         *
+         * If a scan is already in progress, another scan is started as soon as the
+         * current one has finished.
          */
         void startLibraryRescan() noexcept;
 
@@ -126,18 +156,42 @@ class WorkspaceLibraryDb final : public QObject
         void scanSucceeded(int elementCount);
         void scanFailed(QString errorMsg);
 
+        /**
+         * @brief Some library elements were modified, added or removed on the file system
+         *
+         * Emitted after the database entries of the affected elements were updated.
+         *
+         * @param elementDirs   The changed element directories (may not exist anymore)
+         */
+        void elementsChanged(QSet<FilePath> elementDirs);
+
 
     private:
 
         // Private Methods
+        void libraryScanSucceeded() noexcept;
+        void libraryScannerFinished() noexcept;
+        void updateWatchedDirectories() noexcept;
+        void checkForModifiedElementFiles() noexcept;
+        void startElementFilesSweep() noexcept;
+        void elementFilesSweepFinished() noexcept;
+        void watchedDirectoryChanged(const QString& path) noexcept;
+        void processFileSystemChanges() noexcept;
+        bool isElementsDirectory(const FilePath& dir) const noexcept;
         void getElementTranslations(const QString& table, const QString& idRow,
                                     const FilePath& elemDir, const QStringList& localeOrder,
                                     QString* name, QString* desc, QString* keywords) const;
         QMultiMap<Version, FilePath> getElementFilePathsFromDb(const QString& tablename,
                                                                const Uuid& uuid) const;
+        const QHash<Uuid, QMultiMap<Version, FilePath>>& getElementFilePathsCache(
+            const QString& tablename) const;
         FilePath getLatestVersionFilePath(const QMultiMap<Version, FilePath>& list) const noexcept;
         QSet<Uuid> getCategoryChilds(const QString& tablename, const tl::optional<Uuid>& categoryUuid) const;
         QList<Uuid> getCategoryParents(const QString& tablename, const Uuid& category) const;
+        QList<CategoryMetadata> getAllCategories(const QString& tablename,
+                                                 const QStringList& localeOrder) const;
+        static QString getLocalizedValue(const QHash<QString, QString>& values,
+                                         const QStringList& localeOrder) noexcept;
         tl::optional<Uuid> getCategoryParent(const QString& tablename, const Uuid& category) const;
         QSet<Uuid> getElementsByCategory(const QString& tablename, const QString& idrowname,
                                          const tl::optional<Uuid>& categoryUuid) const;
@@ -146,15 +200,54 @@ class WorkspaceLibraryDb final : public QObject
         void createAllTables();
         void setDbVersion(int version);
         int getDbVersion() const noexcept;
+        static QHash<FilePath, QDateTime> getModifiedTimes(const QList<FilePath>& files) noexcept;
 
 
         // Attributes
         Workspace& mWorkspace;
         QScopedPointer<SQLiteDatabase> mDb; ///< the SQLite database "cache.sqlite"
         QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;
+        int mScanGeneration; ///< incremented after every successful library scan
+        bool mFullRescanPending; ///< a rescan was requested while the scanner was busy
+
+        /**
+         * @brief Watches the library and elements directories
+         *
+         * This only reports added, removed or renamed entries, not in-place
+         * modifications of files. Modified element files are detected by comparing
+         * #mElementFileModifiedTimes when the application gets activated.
+         *
+         * The modification times are determined in a worker thread (see
+         * #mElementFilesSweepWatcher) since this needs to access every element file of
+         * the workspace, which would block the GUI for large workspaces.
+         *
+         * Changed directories are collected in #mChangedDirectories and processed after
+         * no more changes were reported within #sFileSystemChangesDelayMs, so e.g. a
+         * `git pull` leads to only one (partial) rescan.
+         */
+        QScopedPointer<QFileSystemWatcher> mFileSystemWatcher;
+        QTimer mFileSystemChangesTimer;
+        QSet<QString> mChangedDirectories;
+        QSet<FilePath> mKnownElementDirs; ///< all element directories of the last scan
+        QList<FilePath> mKnownElementFiles; ///< the main files of #mKnownElementDirs
+        QHash<FilePath, QDateTime> mElementFileModifiedTimes; ///< of the last scan
+        QFutureWatcher<QHash<FilePath, QDateTime>> mElementFilesSweepWatcher;
+        bool mElementFilesSweepIsCheck; ///< compare the result of the running sweep
+        bool mElementFilesBaselineSweepPending; ///< after a scan while a sweep was running
+        bool mElementFilesCheckSweepPending; ///< after activation while a sweep was running
+
+        /**
+         * @brief In-memory cache of all element file paths, per table
+         *
+         * Filled with one query per table on the first lookup and rebuilt when the scan
+         * generation of a table (see #mElementFilePathsCacheGenerations) is outdated.
+         */
+        mutable QHash<QString, QHash<Uuid, QMultiMap<Version, FilePath>>> mElementFilePathsCache;
+        mutable QHash<QString, int> mElementFilePathsCacheGenerations;
 
         // Constants
         static const int sCurrentDbVersion = 1;
+        static const int sFileSystemChangesDelayMs = 500;
 };
 
 /*****************************************************************************************
@@ -24,6 +24,7 @@
 #include "workspacelibraryscanner.h"
 #include <librepcb/common/sqlitedatabase.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/libraryelementmetadata.h>
 #include "../workspace.h"
 
 /*****************************************************************************************
@@ -55,6 +56,20 @@ WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+bool WorkspaceLibraryScanner::startPartialRescan(const QSet<FilePath>& elementDirs) noexcept
+{
+    if (isRunning()) {
+        return false;
+    }
+    mElementDirsToRescan = elementDirs;
+    start();
+    return true;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -73,6 +88,19 @@ QVariant WorkspaceLibraryScanner::optionalToVariant(const tl::optional<ElementNa
 
 void WorkspaceLibraryScanner::run() noexcept
 {
+    // Note: The member is only modified while the thread is not running.
+    QSet<FilePath> elementDirs = mElementDirsToRescan;
+    mElementDirsToRescan.clear();
+    if (!elementDirs.isEmpty()) {
+        try {
+            mAbort = false;
+            rescanElements(elementDirs);
+        } catch (const Exception& e) {
+            emit failed(e.getMsg());
+        }
+        return;
+    }
+
     try {
         mAbort = false;
         emit started();
@@ -133,6 +161,66 @@ void WorkspaceLibraryScanner::run() noexcept
     }
 }
 
+void WorkspaceLibraryScanner::rescanElements(const QSet<FilePath>& elementDirs)
+{
+    // open SQLite database
+    FilePath dbFilePath = mWorkspace.getLibrariesPath().getPathTo("cache.sqlite");
+    SQLiteDatabase db(dbFilePath); // can throw
+
+    // begin database transaction
+    SQLiteDatabase::TransactionScopeGuard transactionGuard(db); // can throw
+
+    // The element type is determined by the name of the parent directory, and the
+    // library by the parent of that directory.
+    foreach (const FilePath& dir, elementDirs) {
+        if (mAbort) return;
+        QList<FilePath> dirs = {dir};
+        QString type = dir.getParentDir().getFilename();
+        int libId = getLibraryId(db, dir.getParentDir().getParentDir()); // can throw
+        if (libId < 0) {
+            qWarning() << "Changed element is not located in a known library:" << dir.toNative();
+        } else if (type == ComponentCategory::getShortElementName()) {
+            removeElementFromDb(db, dir, "component_categories", "cat_id", false);
+            if (LibraryBaseElement::isValidElementDirectory<ComponentCategory>(dir)) {
+                addCategoriesToDb<ComponentCategory>(db, dirs, "component_categories", "cat_id", libId);
+            }
+        } else if (type == PackageCategory::getShortElementName()) {
+            removeElementFromDb(db, dir, "package_categories", "cat_id", false);
+            if (LibraryBaseElement::isValidElementDirectory<PackageCategory>(dir)) {
+                addCategoriesToDb<PackageCategory>(db, dirs, "package_categories", "cat_id", libId);
+            }
+        } else if (type == Symbol::getShortElementName()) {
+            removeElementFromDb(db, dir, "symbols", "symbol_id", true);
+            if (LibraryBaseElement::isValidElementDirectory<Symbol>(dir)) {
+                addElementsToDb<Symbol>(db, dirs, "symbols", "symbol_id", libId);
+            }
+        } else if (type == Package::getShortElementName()) {
+            removeElementFromDb(db, dir, "packages", "package_id", true);
+            if (LibraryBaseElement::isValidElementDirectory<Package>(dir)) {
+                addElementsToDb<Package>(db, dirs, "packages", "package_id", libId);
+            }
+        } else if (type == Component::getShortElementName()) {
+            removeElementFromDb(db, dir, "components", "component_id", true);
+            if (LibraryBaseElement::isValidElementDirectory<Component>(dir)) {
+                addElementsToDb<Component>(db, dirs, "components", "component_id", libId);
+            }
+        } else if (type == Device::getShortElementName()) {
+            removeElementFromDb(db, dir, "devices", "device_id", true);
+            if (LibraryBaseElement::isValidElementDirectory<Device>(dir)) {
+                addDevicesToDb(db, dirs, "devices", "device_id", libId);
+            }
+        } else {
+            qWarning() << "Changed directory is not a library element:" << dir.toNative();
+        }
+    }
+
+    // commit transaction
+    if (!mAbort) {
+        transactionGuard.commit(); // can throw
+        emit elementsChanged(elementDirs);
+    }
+}
+
 void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db)
 {
     // libraries
@@ -194,6 +282,43 @@ int WorkspaceLibraryScanner::addLibraryToDb(SQLiteDatabase& db,
     return id;
 }
 
+int WorkspaceLibraryScanner::getLibraryId(SQLiteDatabase& db, const FilePath& libDir)
+{
+    QSqlQuery query = db.prepareQuery(
+        "SELECT id FROM libraries WHERE filepath = :filepath LIMIT 1");
+    query.bindValue(":filepath", libDir.toRelative(mWorkspace.getLibrariesPath()));
+    db.exec(query);
+
+    if (query.next()) {
+        bool ok = false;
+        int id = query.value(0).toInt(&ok);
+        if (!ok) throw LogicError(__FILE__, __LINE__);
+        return id;
+    } else {
+        return -1;
+    }
+}
+
+void WorkspaceLibraryScanner::removeElementFromDb(SQLiteDatabase& db,
+    const FilePath& elementDir, const QString& table, const QString& idColumn,
+    bool hasCategories)
+{
+    QString filepath = elementDir.toRelative(mWorkspace.getLibrariesPath());
+    QStringList childTables = {table % "_tr"};
+    if (hasCategories) childTables.append(table % "_cat");
+    foreach (const QString& childTable, childTables) {
+        QSqlQuery query = db.prepareQuery(
+            "DELETE FROM " % childTable % " WHERE " % idColumn % " IN "
+            "(SELECT id FROM " % table % " WHERE filepath = :filepath)");
+        query.bindValue(":filepath", filepath);
+        db.exec(query);
+    }
+    QSqlQuery query = db.prepareQuery(
+        "DELETE FROM " % table % " WHERE filepath = :filepath");
+    query.bindValue(":filepath", filepath);
+    db.exec(query);
+}
+
 template <typename ElementType>
 int WorkspaceLibraryScanner::addCategoriesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
     const QString& table, const QString& idColumn, int libId)
@@ -202,7 +327,8 @@ int WorkspaceLibraryScanner::addCategoriesToDb(SQLiteDatabase& db, const QList<F
     foreach (const FilePath& filepath, dirs) {
         if (mAbort) break;
         try {
-            ElementType element(filepath, true); // can throw
+            LibraryElementMetadata element =
+                LibraryElementMetadata::open<ElementType>(filepath); // can throw
             QSqlQuery query = db.prepareQuery(
                 "INSERT INTO " % table % " "
                 "(lib_id, filepath, uuid, version, parent_uuid) VALUES "
@@ -241,7 +367,8 @@ int WorkspaceLibraryScanner::addElementsToDb(SQLiteDatabase& db, const QList<Fil
     foreach (const FilePath& filepath, dirs) {
         if (mAbort) break;
         try {
-            ElementType element(filepath, true); // can throw
+            LibraryElementMetadata element =
+                LibraryElementMetadata::open<ElementType>(filepath); // can throw
             QSqlQuery query = db.prepareQuery(
                 "INSERT INTO " % table % " "
                 "(lib_id, filepath, uuid, version) VALUES "
@@ -287,7 +414,8 @@ int WorkspaceLibraryScanner::addDevicesToDb(SQLiteDatabase& db, const QList<File
     foreach (const FilePath& filepath, dirs) {
         if (mAbort) break;
         try {
-            Device element(filepath, true); // can throw
+            LibraryElementMetadata element =
+                LibraryElementMetadata::open<Device>(filepath); // can throw
             QSqlQuery query = db.prepareQuery(
                 "INSERT INTO " % table % " "
                 "(lib_id, filepath, uuid, version, component_uuid, package_uuid) VALUES "
@@ -296,8 +424,8 @@ int WorkspaceLibraryScanner::addDevicesToDb(SQLiteDatabase& db, const QList<File
             query.bindValue(":filepath",        filepath.toRelative(mWorkspace.getLibrariesPath()));
             query.bindValue(":uuid",            element.getUuid().toStr());
             query.bindValue(":version",         element.getVersion().toStr());
-            query.bindValue(":component_uuid",  element.getComponentUuid().toStr());
-            query.bindValue(":package_uuid",    element.getPackageUuid().toStr());
+            query.bindValue(":component_uuid",  element.getComponentUuid()->toStr());
+            query.bindValue(":package_uuid",    element.getPackageUuid()->toStr());
             int id = db.insert(query);
             foreach (const QString& locale, element.getAllAvailableLocales()) {
                 QSqlQuery query = db.prepareQuery(
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/filepath.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -72,6 +73,22 @@ class WorkspaceLibraryScanner final : public QThread
         WorkspaceLibraryScanner(const WorkspaceLibraryScanner& other) = delete;
         ~WorkspaceLibraryScanner() noexcept;
 
+        // General Methods
+
+        /**
+         * @brief Start rescanning only some library element directories
+         *
+         * The database entries of the passed elements are removed and (if the element
+         * directories still exist) added again. Other elements are not touched. On
+         * success, #elementsChanged() is emitted instead of #succeeded().
+         *
+         * @param elementDirs   Element directories to rescan (may not exist anymore)
+         *
+         * @retval true     If the rescan was started
+         * @retval false    If the scanner is currently busy (try again later)
+         */
+        bool startPartialRescan(const QSet<FilePath>& elementDirs) noexcept;
+
         // Operator Overloadings
         WorkspaceLibraryScanner& operator=(const WorkspaceLibraryScanner& rhs) = delete;
 
@@ -82,12 +99,18 @@ class WorkspaceLibraryScanner final : public QThread
         void progressUpdate(int percent);
         void succeeded(int elementCount);
         void failed(QString errorMsg);
+        void elementsChanged(QSet<FilePath> elementDirs);
 
 
     private: // Methods
 
         void run() noexcept override;
+        void rescanElements(const QSet<FilePath>& elementDirs);
         void clearAllTables(SQLiteDatabase& db);
+        int getLibraryId(SQLiteDatabase& db, const FilePath& libDir);
+        void removeElementFromDb(SQLiteDatabase& db, const FilePath& elementDir,
+                                 const QString& table, const QString& idColumn,
+                                 bool hasCategories);
         int addLibraryToDb(SQLiteDatabase& db, const QSharedPointer<library::Library>& lib);
         template <typename ElementType>
         int addCategoriesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
@@ -105,6 +128,7 @@ class WorkspaceLibraryScanner final : public QThread
 
         Workspace& mWorkspace;
         volatile bool mAbort;
+        QSet<FilePath> mElementDirsToRescan; ///< empty for a full rescan
 };
 
 /*****************************************************************************************
@@ -0,0 +1,131 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/filewritebatch.h>
+#include <librepcb/common/fileio/smartsexprfile.h>
+#include <librepcb/common/fileio/fileutils.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class FileWriteBatchTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("FileWriteBatchTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        SExpression createDom() const
+        {
+            SExpression root = SExpression::createList("librepcb_test");
+            root.appendChild("name", QString("foo"), true);
+            return root;
+        }
+
+        FilePath mTempDir;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(FileWriteBatchTest, testFilesAreWrittenOnlyOnExecute)
+{
+    FilePath fp = mTempDir.getPathTo("file.lp");
+    QScopedPointer<SmartSExprFile> file(SmartSExprFile::create(fp));
+    FileWriteBatch batch;
+    {
+        FileWriteBatch::Recorder recorder(batch);
+        EXPECT_EQ(&batch, FileWriteBatch::getActive());
+        file->save(createDom(), true);
+    }
+    EXPECT_EQ(nullptr, FileWriteBatch::getActive());
+    EXPECT_EQ(1, batch.getCount());
+    EXPECT_FALSE(fp.isExistingFile());
+
+    QStringList errors;
+    EXPECT_TRUE(batch.execute(errors));
+    EXPECT_TRUE(errors.isEmpty());
+    EXPECT_EQ(SmartSExprFile::serialize(createDom()), FileUtils::readFile(fp));
+}
+
+TEST_F(FileWriteBatchTest, testOperationsAreExecutedInOrder)
+{
+    FilePath fp = mTempDir.getPathTo("file.txt");
+    FileWriteBatch batch;
+    batch.writeFile(fp, QByteArray("foo"));
+    batch.removeFile(fp);
+    batch.writeFile(fp, QByteArray("bar"));
+
+    QStringList errors;
+    EXPECT_TRUE(batch.execute(errors));
+    EXPECT_EQ(QByteArray("bar"), FileUtils::readFile(fp));
+}
+
+TEST_F(FileWriteBatchTest, testOnlyModifiedFilesAreCounted)
+{
+    FilePath fp1 = mTempDir.getPathTo("file1.txt");
+    FilePath fp2 = mTempDir.getPathTo("file2.txt");
+    FileUtils::writeFile(fp1, QByteArray("foo"));
+    FileWriteBatch batch;
+    batch.writeFile(fp1, QByteArray("foo"));
+    batch.writeFile(fp2, QByteArray("bar"));
+
+    QStringList errors;
+    int writtenFiles = 0;
+    EXPECT_TRUE(batch.execute(errors, &writtenFiles));
+    EXPECT_EQ(1, writtenFiles);
+    writtenFiles = 0;
+    EXPECT_TRUE(batch.execute(errors, &writtenFiles));
+    EXPECT_EQ(0, writtenFiles);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,100 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/sexpression.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class SExpressionTest : public ::testing::Test
+{
+    protected:
+        const QString mContent = QString(
+            "(librepcb_symbol \"c2ceffd2-4cc5-43c6-941c-fc64a341d026\"\n"
+            " (name \"Foo (bar)\")\n"
+            " (description \"escaped \\\" quote )\")\n"
+            " (version 0.1)\n"
+            " (pin 4484ba9b-f3f8-4487-9109-10a8e9844fdc (name 1))\n"
+            " (version 0.2)\n"
+            ")\n");
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(SExpressionTest, testParseHeaderStopsAtFirstUnknownNode)
+{
+    QSet<QString> names = {"name", "description", "version"};
+    SExpression root = SExpression::parseHeader(mContent, FilePath(), names);
+    EXPECT_EQ(QString("librepcb_symbol"), root.getName());
+    EXPECT_EQ(4, root.getChildren().count());
+    EXPECT_EQ(QString("c2ceffd2-4cc5-43c6-941c-fc64a341d026"),
+              root.getChildByIndex(0).getValue<QString>());
+    EXPECT_EQ(QString("Foo (bar)"), root.getValueByPath<QString>("name"));
+    EXPECT_EQ(QString("escaped \" quote )"), root.getValueByPath<QString>("description"));
+    EXPECT_EQ(QString("0.1"), root.getValueByPath<QString>("version"));
+    EXPECT_EQ(nullptr, root.tryGetChildByPath("pin"));
+}
+
+TEST_F(SExpressionTest, testParseHeaderEqualsParseIfAllNodesAreRequested)
+{
+    QSet<QString> names = {"name", "description", "version", "pin"};
+    SExpression header = SExpression::parseHeader(mContent, FilePath(), names);
+    SExpression full = SExpression::parse(mContent, FilePath());
+    EXPECT_EQ(full.toString(0), header.toString(0));
+}
+
+TEST_F(SExpressionTest, testEqualityComparesContent)
+{
+    SExpression dom1 = SExpression::parse(mContent, FilePath());
+    SExpression dom2 = SExpression::parse(mContent, FilePath::getApplicationTempPath());
+    EXPECT_TRUE(dom1 == dom2); // the file path is ignored
+    EXPECT_FALSE(dom1 != dom2);
+    dom2.appendChild("foo", QString("bar"), true);
+    EXPECT_FALSE(dom1 == dom2);
+    EXPECT_TRUE(dom1 != dom2);
+}
+
+TEST_F(SExpressionTest, testParseHeaderThrowsOnUnterminatedInput)
+{
+    QSet<QString> names = {"name"};
+    EXPECT_THROW(SExpression::parseHeader("(root (name \"foo\"", FilePath(), names),
+                 Exception);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
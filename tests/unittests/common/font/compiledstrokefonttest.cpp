@@ -0,0 +1,245 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/font/compiledstrokefont.h>
+#include <fontobene/font.h>
+#include <fontobene/glyphlistaccessor.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class CompiledStrokeFontTest : public ::testing::Test
+{
+    protected:
+
+        /// Build a font with a "-" glyph, a space and the replacement character
+        static QByteArray createFontData(quint32 version = 1) {
+            QByteArray data;
+            QDataStream s(&data, QIODevice::WriteOnly);
+            s.setByteOrder(QDataStream::LittleEndian);
+            s.setFloatingPointPrecision(QDataStream::DoublePrecision);
+            s.writeRawData("LPSFONT", 8); // including the null terminator
+            s << version << quint32(3) << qreal(0.25) << qreal(1.5);
+            s << quint32(0x0020) << quint32(56);
+            s << quint32(0x002D) << quint32(68);
+            s << quint32(0xFFFD) << quint32(132);
+            s << qreal(0.5) << quint32(0); // space
+            s << qreal(0.1) << quint32(1) << quint32(2) // minus
+              << qreal(0.1) << qreal(0.5) << qreal(0)
+              << qreal(0.6) << qreal(0.5) << qreal(0);
+            s << qreal(0.2) << quint32(1) << quint32(1) // replacement character
+              << qreal(0.3) << qreal(0.3) << qreal(-90);
+            return data;
+        }
+
+        /// A small fontobene font with a MU (but no MICRO SIGN), an OHM SIGN (but no
+        /// OMEGA), a glyph reference and the replacement character
+        static QByteArray createBeneFont() {
+            return QByteArray(
+                "[format]\n"
+                "format = FontoBene\n"
+                "format_version = 1.0\n"
+                "\n"
+                "[font]\n"
+                "name = Test Font\n"
+                "id = testfont\n"
+                "version = 1.0\n"
+                "author = LibrePCB\n"
+                "license = CC0\n"
+                "letter_spacing = 1.5\n"
+                "line_spacing = 13.5\n"
+                "\n"
+                "---\n"
+                "\n"
+                "[0020] SPACE\n"
+                "~6\n"
+                "\n"
+                "[002D] HYPHEN-MINUS\n"
+                "0,4.5;4.5,4.5\n"
+                "\n"
+                "[003D] EQUALS SIGN\n"
+                "@002D\n"
+                "0,3;4.5,3\n"
+                "\n"
+                "[03BC] GREEK SMALL LETTER MU\n"
+                "0,-3;0,6\n"
+                "0,1.5,-90;3,0;4.5,1.5;4.5,6\n"
+                "\n"
+                "[2126] OHM SIGN\n"
+                "0,0;1.5,0;1.5,1.5,120;3,1.5;3,0;4.5,0\n"
+                "\n"
+                "[FFFD] REPLACEMENT CHARACTER\n"
+                "0,0;4.5,0;4.5,9;0,9;0,0\n");
+        }
+
+        /// Compare a glyph of the compiled font with the glyph of the fontobene font
+        static void expectGlyphEquals(const CompiledStrokeFont& font, uint codepoint,
+                                      fb::GlyphListAccessor& accessor, uint expectedCodepoint) {
+            qreal expectedSpacing = 0;
+            QVector<fb::Polyline> expected;
+            foreach (const fb::Polyline& p,
+                     accessor.getAllPolylinesOfGlyph(expectedCodepoint, &expectedSpacing)) {
+                if (!p.isEmpty()) expected.append(p);
+            }
+
+            qreal spacing = 0;
+            QVector<CompiledStrokeFont::Polyline> polylines;
+            ASSERT_TRUE(font.getGlyph(codepoint, polylines, spacing)) << codepoint;
+            EXPECT_EQ(expectedSpacing / 9, spacing) << codepoint;
+            ASSERT_EQ(expected.count(), polylines.count()) << codepoint;
+            for (int i = 0; i < expected.count(); ++i) {
+                ASSERT_EQ(expected.at(i).count(), polylines.at(i).count()) << codepoint;
+                for (int k = 0; k < expected.at(i).count(); ++k) {
+                    const fb::Vertex& v = expected.at(i).at(k);
+                    EXPECT_EQ(v.scaledX(1), polylines.at(i).at(k).x) << codepoint;
+                    EXPECT_EQ(v.scaledY(1), polylines.at(i).at(k).y) << codepoint;
+                    EXPECT_EQ(v.scaledBulge(180), polylines.at(i).at(k).angle) << codepoint;
+                }
+            }
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(CompiledStrokeFontTest, testEmptyFont)
+{
+    CompiledStrokeFont font;
+    QVector<CompiledStrokeFont::Polyline> polylines;
+    qreal spacing = 1;
+    EXPECT_EQ(0, font.getGlyphCount());
+    EXPECT_FALSE(font.getGlyph('A', polylines, spacing));
+    EXPECT_EQ(0, polylines.count());
+    EXPECT_EQ(0, spacing);
+}
+
+TEST_F(CompiledStrokeFontTest, testGetGlyph)
+{
+    CompiledStrokeFont font(createFontData());
+    EXPECT_EQ(3, font.getGlyphCount());
+    EXPECT_EQ(0.25, font.getLetterSpacing());
+    EXPECT_EQ(1.5, font.getLineSpacing());
+
+    QVector<CompiledStrokeFont::Polyline> polylines;
+    qreal spacing = 0;
+    EXPECT_TRUE(font.getGlyph(' ', polylines, spacing));
+    EXPECT_EQ(0, polylines.count());
+    EXPECT_EQ(0.5, spacing);
+
+    EXPECT_TRUE(font.getGlyph('-', polylines, spacing));
+    ASSERT_EQ(1, polylines.count());
+    ASSERT_EQ(2, polylines.first().count());
+    EXPECT_EQ(0.1, spacing);
+    EXPECT_EQ(0.6, polylines.first().last().x);
+    EXPECT_EQ(0.5, polylines.first().last().y);
+}
+
+TEST_F(CompiledStrokeFontTest, testReplacementGlyph)
+{
+    CompiledStrokeFont font(createFontData());
+    QVector<CompiledStrokeFont::Polyline> polylines;
+    qreal spacing = 0;
+    EXPECT_TRUE(font.getGlyph('A', polylines, spacing));
+    ASSERT_EQ(1, polylines.count());
+    ASSERT_EQ(1, polylines.first().count());
+    EXPECT_EQ(0.2, spacing);
+    EXPECT_EQ(-90, polylines.first().first().angle);
+}
+
+TEST_F(CompiledStrokeFontTest, testInvalidData)
+{
+    QByteArray data = createFontData();
+    EXPECT_THROW(CompiledStrokeFont(QByteArray()), Exception);
+    EXPECT_THROW(CompiledStrokeFont(data.left(40)), Exception);
+    EXPECT_THROW(CompiledStrokeFont(createFontData(2)), Exception);
+    data[0] = 'X';
+    EXPECT_THROW(CompiledStrokeFont(data), Exception);
+}
+
+TEST_F(CompiledStrokeFontTest, testTruncatedGlyphData)
+{
+    CompiledStrokeFont font(createFontData().left(100));
+    QVector<CompiledStrokeFont::Polyline> polylines;
+    qreal spacing = 0;
+    EXPECT_TRUE(font.getGlyph(' ', polylines, spacing));
+    EXPECT_FALSE(font.getGlyph('-', polylines, spacing));
+}
+
+TEST_F(CompiledStrokeFontTest, testCompileAndLoadRoundTrip)
+{
+    FilePath dir = FilePath::getRandomTempPath();
+    FilePath fontFile = dir.getPathTo("test.bene");
+    FilePath cacheDir = dir.getPathTo("cache");
+    FileUtils::writeFile(fontFile, createBeneFont());
+    FileUtils::makePath(cacheDir);
+
+    // the first load compiles the font and writes the cache, the second one reads it
+    CompiledStrokeFont compiled = CompiledStrokeFont::load(fontFile, cacheDir);
+    EXPECT_EQ(1, FileUtils::getFilesInDirectory(cacheDir).count());
+    CompiledStrokeFont font = CompiledStrokeFont::load(fontFile, cacheDir);
+    EXPECT_EQ(compiled.getData(), font.getData());
+    EXPECT_EQ(CompiledStrokeFont::compile(fontFile).getData(), font.getData());
+
+    fb::Font beneFont(fontFile.toStr());
+    fb::GlyphListCache cache(beneFont.glyphs);
+    cache.addReplacements({0x00B5, 0x03BC});
+    cache.addReplacements({0x2126, 0x03A9});
+    fb::GlyphListAccessor accessor(cache);
+    EXPECT_EQ(beneFont.header.letterSpacing / 9, font.getLetterSpacing());
+    EXPECT_EQ(beneFont.header.lineSpacing / 9, font.getLineSpacing());
+
+    // defined glyphs, including a glyph reference
+    expectGlyphEquals(font, 0x0020, accessor, 0x0020);
+    expectGlyphEquals(font, 0x002D, accessor, 0x002D);
+    expectGlyphEquals(font, 0x003D, accessor, 0x003D);
+    expectGlyphEquals(font, 0xFFFD, accessor, 0xFFFD);
+
+    // MICRO SIGN and OMEGA only exist through their replacements
+    expectGlyphEquals(font, 0x03BC, accessor, 0x03BC);
+    expectGlyphEquals(font, 0x00B5, accessor, 0x03BC);
+    expectGlyphEquals(font, 0x2126, accessor, 0x2126);
+    expectGlyphEquals(font, 0x03A9, accessor, 0x2126);
+
+    // undefined glyphs are not compiled, but fall back to the replacement character
+    EXPECT_EQ(8, font.getGlyphCount());
+    expectGlyphEquals(font, 'A', accessor, 0xFFFD);
+
+    FileUtils::removeDirRecursively(dir);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
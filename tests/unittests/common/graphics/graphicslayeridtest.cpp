@@ -0,0 +1,126 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/graphics/graphicslayerid.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GraphicsLayerIdTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(GraphicsLayerIdTest, testInvalid)
+{
+    GraphicsLayerId id;
+    EXPECT_FALSE(id.isValid());
+    EXPECT_EQ(-1, id.toInt());
+    EXPECT_EQ(QString(), id.getName());
+    EXPECT_FALSE(id.getMirrored().isValid());
+    EXPECT_FALSE(id.isCopperLayer());
+}
+
+TEST(GraphicsLayerIdTest, testInterning)
+{
+    GraphicsLayerId id1(GraphicsLayer::sTopCopper);
+    GraphicsLayerId id2(QString(GraphicsLayer::sTopCopper));
+    GraphicsLayerId id3(GraphicsLayer::sBoardOutlines);
+    EXPECT_TRUE(id1.isValid());
+    EXPECT_EQ(id1, id2);
+    EXPECT_EQ(id1.toInt(), id2.toInt());
+    EXPECT_NE(id1, id3);
+    EXPECT_EQ(QString(GraphicsLayer::sTopCopper), id1.getName());
+    EXPECT_EQ(id1, GraphicsLayerId::find(GraphicsLayer::sTopCopper));
+    EXPECT_LT(id1.toInt(), GraphicsLayerId::getRegisteredCount());
+}
+
+TEST(GraphicsLayerIdTest, testFindDoesNotRegister)
+{
+    int count = GraphicsLayerId::getRegisteredCount();
+    EXPECT_FALSE(GraphicsLayerId::find("graphicslayeridtest_unknown").isValid());
+    EXPECT_EQ(count, GraphicsLayerId::getRegisteredCount());
+}
+
+TEST(GraphicsLayerIdTest, testMirrored)
+{
+    GraphicsLayerId top(GraphicsLayer::sTopPlacement);
+    GraphicsLayerId bot(GraphicsLayer::sBotPlacement);
+    GraphicsLayerId outlines(GraphicsLayer::sBoardOutlines);
+    EXPECT_EQ(bot, top.getMirrored());
+    EXPECT_EQ(top, bot.getMirrored());
+    EXPECT_EQ(outlines, outlines.getMirrored());
+    EXPECT_TRUE(GraphicsLayerId("top_graphicslayeridtest").getMirrored().isValid());
+    EXPECT_EQ(QString("bot_graphicslayeridtest"),
+              GraphicsLayerId("top_graphicslayeridtest").getMirrored().getName());
+}
+
+TEST(GraphicsLayerIdTest, testProperties)
+{
+    GraphicsLayerId top(GraphicsLayer::sTopCopper);
+    GraphicsLayerId inner(GraphicsLayer::getInnerLayerName(3));
+    GraphicsLayerId outlines(GraphicsLayer::sBoardOutlines);
+    EXPECT_TRUE(top.isTopLayer());
+    EXPECT_TRUE(top.isCopperLayer());
+    EXPECT_FALSE(top.isBottomLayer());
+    EXPECT_TRUE(inner.isInnerLayer());
+    EXPECT_TRUE(inner.isCopperLayer());
+    EXPECT_FALSE(outlines.isCopperLayer());
+}
+
+TEST(GraphicsLayerIdTest, testSet)
+{
+    GraphicsLayerId top(GraphicsLayer::sTopCopper);
+    GraphicsLayerId bot(GraphicsLayer::sBotCopper);
+    GraphicsLayerId outlines(GraphicsLayer::sBoardOutlines);
+    GraphicsLayerIdSet set = {top, bot};
+    EXPECT_FALSE(set.isEmpty());
+    EXPECT_TRUE(set.contains(top));
+    EXPECT_TRUE(set.contains(bot));
+    EXPECT_FALSE(set.contains(outlines));
+    EXPECT_FALSE(set.contains(GraphicsLayerId()));
+    set.remove(top);
+    EXPECT_FALSE(set.contains(top));
+    set.insert(outlines);
+    EXPECT_TRUE(set.contains(outlines));
+    set.clear();
+    EXPECT_TRUE(set.isEmpty());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
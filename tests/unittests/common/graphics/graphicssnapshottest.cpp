@@ -0,0 +1,160 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtGui>
+#include <librepcb/common/graphics/graphicssnapshot.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GraphicsSnapshotTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("GraphicsSnapshotTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        // a red rectangle of 1x0.5 inch, which results in a 27.4x14.7mm image because
+        // of the 1mm margin added on each side
+        GraphicsSnapshot createSnapshot() const
+        {
+            QPainterPath path;
+            path.addRect(0, 0, Length::fromInch(1).toPx(), Length::fromInch(0.5).toPx());
+            GraphicsSnapshot snapshot;
+            snapshot.drawPath(path, Qt::NoPen, QBrush(Qt::red, Qt::SolidPattern));
+            return snapshot;
+        }
+
+        FilePath mTempDir;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GraphicsSnapshotTest, testInvisiblePrimitivesAreNotRecorded)
+{
+    GraphicsSnapshot snapshot;
+    snapshot.drawPath(QPainterPath(), QPen(Qt::red), QBrush(Qt::red));
+    snapshot.drawLine(QLineF(0, 0, 10, 10), Qt::NoPen);
+    snapshot.drawText(QRectF(0, 0, 10, 10), Qt::AlignLeft, QString(), QFont(), Qt::red);
+    EXPECT_TRUE(snapshot.isEmpty());
+    EXPECT_EQ(0, snapshot.getPrimitiveCount());
+}
+
+TEST_F(GraphicsSnapshotTest, testBoundingRectContainsPenAndTransform)
+{
+    GraphicsSnapshot snapshot;
+    snapshot.drawLine(QLineF(0, 0, 10, 0), QPen(Qt::red, 2),
+                      QTransform::fromTranslate(100, 50));
+    EXPECT_EQ(1, snapshot.getPrimitiveCount());
+    EXPECT_EQ(QRectF(99, 49, 12, 2), snapshot.getBoundingRect());
+}
+
+TEST_F(GraphicsSnapshotTest, testToImage)
+{
+    QImage image = createSnapshot().toImage(254, Qt::white);
+    ASSERT_FALSE(image.isNull());
+    EXPECT_EQ(QSize(274, 147), image.size());
+    EXPECT_EQ(10000, image.dotsPerMeterX());
+    EXPECT_EQ(10000, image.dotsPerMeterY());
+    EXPECT_EQ(QColor(Qt::white), QColor(image.pixel(2, 2)));     // margin
+    EXPECT_EQ(QColor(Qt::red), QColor(image.pixel(137, 73)));    // content
+}
+
+TEST_F(GraphicsSnapshotTest, testToImageTooLarge)
+{
+    EXPECT_TRUE(createSnapshot().toImage(1000000, Qt::white).isNull());
+}
+
+TEST_F(GraphicsSnapshotTest, testToSvg)
+{
+    QString svg = QString::fromUtf8(createSnapshot().toSvg(Qt::white));
+    EXPECT_TRUE(svg.contains("xmlns=\"http://www.w3.org/2000/svg\"")) << qPrintable(svg);
+    EXPECT_TRUE(svg.contains("width=\"27.4mm\"")) << qPrintable(svg);
+    EXPECT_TRUE(svg.contains("height=\"14.7mm\"")) << qPrintable(svg);
+    EXPECT_TRUE(svg.contains("<rect ")) << qPrintable(svg);
+    EXPECT_TRUE(svg.contains("fill=\"#ffffff\"")) << qPrintable(svg);
+    EXPECT_EQ(1, svg.count("<path ")) << qPrintable(svg);
+    EXPECT_TRUE(svg.contains("fill=\"#ff0000\"")) << qPrintable(svg);
+    EXPECT_FALSE(svg.contains("stroke=")) << qPrintable(svg);
+}
+
+TEST_F(GraphicsSnapshotTest, testToSvgWithTransparentBackground)
+{
+    QString svg = QString::fromUtf8(createSnapshot().toSvg(Qt::transparent));
+    EXPECT_FALSE(svg.contains("<rect ")) << qPrintable(svg);
+    EXPECT_EQ(1, svg.count("<path ")) << qPrintable(svg);
+}
+
+TEST_F(GraphicsSnapshotTest, testSaveToFile)
+{
+    GraphicsSnapshot snapshot = createSnapshot();
+
+    FilePath svgFile = mTempDir.getPathTo("snapshot.svg");
+    snapshot.saveToFile(svgFile, 254, Qt::white);
+    EXPECT_EQ(snapshot.toSvg(Qt::white), FileUtils::readFile(svgFile));
+
+    FilePath pngFile = mTempDir.getPathTo("snapshot.png");
+    snapshot.saveToFile(pngFile, 254, Qt::white);
+    QImage image(pngFile.toStr(), "png");
+    ASSERT_FALSE(image.isNull());
+    EXPECT_EQ(QSize(274, 147), image.size());
+    EXPECT_EQ(QColor(Qt::red), QColor(image.pixel(137, 73)));
+}
+
+TEST_F(GraphicsSnapshotTest, testSaveToFileWithUnsupportedSuffix)
+{
+    FilePath fp = mTempDir.getPathTo("snapshot.foo");
+    EXPECT_THROW(createSnapshot().saveToFile(fp, 254, Qt::white), Exception);
+    EXPECT_FALSE(fp.isExistingFile());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,141 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtWidgets>
+#include <librepcb/common/graphics/graphicstilecache.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GraphicsTileCacheTest : public ::testing::Test
+{
+    protected:
+
+        class CountingItem final : public QGraphicsRectItem
+        {
+            public:
+                CountingItem(const QRectF& rect) : QGraphicsRectItem(rect), mPaintCount(0) {}
+                void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+                           QWidget* widget) override {
+                    ++mPaintCount;
+                    QGraphicsRectItem::paint(painter, option, widget);
+                }
+                int mPaintCount;
+        };
+
+        void paint(GraphicsTileCache& cache, const QGraphicsScene& scene, qreal scale) {
+            QPixmap target(100, 100);
+            QPainter painter(&target);
+            painter.setWorldTransform(QTransform::fromScale(scale, scale));
+            cache.paint(painter, QRectF(0, 0, 100 / scale, 100 / scale), scene, nullptr);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GraphicsTileCacheTest, testTransformSupported)
+{
+    EXPECT_TRUE(GraphicsTileCache::isTransformSupported(QTransform()));
+    EXPECT_TRUE(GraphicsTileCache::isTransformSupported(QTransform::fromScale(2, 2)));
+    EXPECT_TRUE(GraphicsTileCache::isTransformSupported(QTransform::fromTranslate(10, 20)));
+    EXPECT_FALSE(GraphicsTileCache::isTransformSupported(QTransform::fromScale(2, 3)));
+    EXPECT_FALSE(GraphicsTileCache::isTransformSupported(QTransform::fromScale(-1, -1)));
+    EXPECT_FALSE(GraphicsTileCache::isTransformSupported(QTransform().rotate(45)));
+}
+
+TEST_F(GraphicsTileCacheTest, testCacheable)
+{
+    QGraphicsRectItem parent;
+    QGraphicsRectItem child(&parent);
+    EXPECT_TRUE(GraphicsTileCache::isCacheable(child));
+    GraphicsTileCache::setCacheable(parent, false);
+    EXPECT_FALSE(GraphicsTileCache::isCacheable(parent));
+    EXPECT_FALSE(GraphicsTileCache::isCacheable(child));
+    GraphicsTileCache::setCacheable(parent, true);
+    EXPECT_TRUE(GraphicsTileCache::isCacheable(child));
+}
+
+TEST_F(GraphicsTileCacheTest, testTilesAreReused)
+{
+    QGraphicsScene scene;
+    CountingItem* item = new CountingItem(QRectF(10, 10, 20, 20));
+    scene.addItem(item);
+    GraphicsTileCache cache;
+
+    paint(cache, scene, 1);
+    EXPECT_EQ(1, item->mPaintCount);
+    EXPECT_EQ(1, cache.getTileCount());
+    paint(cache, scene, 1);
+    EXPECT_EQ(1, item->mPaintCount); // painted from cache
+
+    paint(cache, scene, 2); // another zoom level
+    EXPECT_EQ(2, item->mPaintCount);
+    paint(cache, scene, 1); // tiles of the previous zoom level are still available
+    EXPECT_EQ(2, item->mPaintCount);
+}
+
+TEST_F(GraphicsTileCacheTest, testInvalidate)
+{
+    QGraphicsScene scene;
+    CountingItem* item = new CountingItem(QRectF(10, 10, 20, 20));
+    scene.addItem(item);
+    GraphicsTileCache cache;
+
+    paint(cache, scene, 1);
+    EXPECT_EQ(1, item->mPaintCount);
+    cache.invalidate(QRectF(1000, 1000, 10, 10)); // outside of the tile
+    paint(cache, scene, 1);
+    EXPECT_EQ(1, item->mPaintCount);
+    cache.invalidate(item->sceneBoundingRect());
+    EXPECT_EQ(0, cache.getTileCount());
+    paint(cache, scene, 1);
+    EXPECT_EQ(2, item->mPaintCount);
+}
+
+TEST_F(GraphicsTileCacheTest, testNotCacheableItemsAreNotPainted)
+{
+    QGraphicsScene scene;
+    CountingItem* item = new CountingItem(QRectF(10, 10, 20, 20));
+    GraphicsTileCache::setCacheable(*item, false);
+    scene.addItem(item);
+    GraphicsTileCache cache;
+
+    paint(cache, scene, 1);
+    EXPECT_EQ(0, item->mPaintCount);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtWidgets>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/common/graphics/graphicsview.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GraphicsViewTest : public ::testing::Test
+{
+    protected:
+
+        class CountingItem final : public QGraphicsRectItem
+        {
+            public:
+                CountingItem(const QRectF& rect) : QGraphicsRectItem(rect), mPaintCount(0) {}
+                void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+                           QWidget* widget) override {
+                    ++mPaintCount;
+                    QGraphicsRectItem::paint(painter, option, widget);
+                }
+                int mPaintCount;
+        };
+
+        void paint(GraphicsView& view) {
+            QPixmap target(view.viewport()->size());
+            QPainter painter(&target);
+            view.render(&painter);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GraphicsViewTest, testLayerChangesInvalidateTileCache)
+{
+    GraphicsScene scene;
+    CountingItem item(QRectF(10, 10, 20, 20));
+    scene.addItem(item);
+    GraphicsLayer layer("test");
+    GraphicsView view;
+    view.resize(200, 200);
+    view.setUseTileCache(true);
+    view.setScene(&scene);
+    view.setObservedLayers({&layer});
+
+    paint(view);
+    EXPECT_EQ(1, item.mPaintCount);
+    paint(view);
+    EXPECT_EQ(1, item.mPaintCount); // painted from cache
+
+    layer.setVisible(!layer.isVisible());
+    paint(view);
+    EXPECT_EQ(2, item.mPaintCount);
+
+    layer.setColor(Qt::red);
+    paint(view);
+    EXPECT_EQ(3, item.mPaintCount);
+
+    view.setObservedLayers({}); // not observed anymore
+    paint(view);
+    EXPECT_EQ(4, item.mPaintCount); // changing the observed layers invalidates the cache
+    layer.setColor(Qt::blue);
+    paint(view);
+    EXPECT_EQ(4, item.mPaintCount);
+
+    scene.removeItem(item);
+    view.setScene(nullptr);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
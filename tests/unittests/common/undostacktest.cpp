@@ -0,0 +1,146 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/common/undocommand.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Command
+ ****************************************************************************************/
+
+class UndoStackTestCmd final : public UndoCommand
+{
+    public:
+        UndoStackTestCmd(int& value, int newValue, qint64 extraMemoryUsage = 0) noexcept :
+            UndoCommand("Set value"), mValue(value), mOldValue(value), mNewValue(newValue),
+            mExtraMemoryUsage(extraMemoryUsage) {}
+        bool canMergeWith(const UndoCommand& other) const noexcept override {
+            const UndoStackTestCmd* cmd = dynamic_cast<const UndoStackTestCmd*>(&other);
+            return cmd && (&cmd->mValue == &mValue) && (cmd->mOldValue == mNewValue);
+        }
+        void mergeWith(const UndoCommand& other) noexcept override {
+            mNewValue = static_cast<const UndoStackTestCmd&>(other).mNewValue;
+        }
+        qint64 getEstimatedMemoryUsage() const noexcept override {
+            return UndoCommand::getEstimatedMemoryUsage() + mExtraMemoryUsage;
+        }
+    private:
+        bool performExecute() override {performRedo(); return true;}
+        void performUndo() override {mValue = mOldValue;}
+        void performRedo() override {mValue = mNewValue;}
+        int& mValue;
+        int mOldValue;
+        int mNewValue;
+        qint64 mExtraMemoryUsage;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(UndoStackTest, testConsecutiveCommandsAreMerged)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.execCmd(new UndoStackTestCmd(value, 1));
+    stack.execCmd(new UndoStackTestCmd(value, 2));
+    stack.execCmd(new UndoStackTestCmd(value, 3));
+    EXPECT_EQ(3, value);
+    stack.undo();
+    EXPECT_EQ(0, value);
+    EXPECT_FALSE(stack.canUndo());
+    stack.redo();
+    EXPECT_EQ(3, value);
+}
+
+TEST(UndoStackTest, testCommandsAreNotMergedIntoCleanState)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.execCmd(new UndoStackTestCmd(value, 1));
+    stack.setClean();
+    stack.execCmd(new UndoStackTestCmd(value, 2));
+    stack.undo();
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(stack.isClean());
+}
+
+TEST(UndoStackTest, testOldestCommandsAreRemovedIfLimitIsExceeded)
+{
+    int value1 = 0;
+    int value2 = 0;
+    UndoStack stack;
+    stack.setLimits(2, 0);
+    stack.execCmd(new UndoStackTestCmd(value1, 1));
+    stack.execCmd(new UndoStackTestCmd(value2, 1)); // different object --> not merged
+    stack.execCmd(new UndoStackTestCmd(value1, 2));
+    stack.undo();
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_EQ(1, value1);
+    EXPECT_EQ(0, value2);
+    EXPECT_FALSE(stack.isClean()); // the clean state was removed
+}
+
+TEST(UndoStackTest, testOldestCommandsAreRemovedIfMemoryLimitIsExceeded)
+{
+    int value1 = 0;
+    int value2 = 0;
+    UndoStack stack;
+    stack.setLimits(0, 2500);
+    stack.execCmd(new UndoStackTestCmd(value1, 1, 1000));
+    stack.execCmd(new UndoStackTestCmd(value2, 1, 1000)); // different object --> not merged
+    stack.execCmd(new UndoStackTestCmd(value1, 2, 1000)); // exceeds the limit
+    stack.undo();
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_EQ(1, value1);
+    EXPECT_EQ(0, value2);
+}
+
+TEST(UndoStackTest, testNewestCommandIsKeptEvenIfMemoryLimitIsExceeded)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setLimits(0, 100);
+    stack.execCmd(new UndoStackTestCmd(value, 1, 1000));
+    EXPECT_TRUE(stack.canUndo());
+    stack.undo();
+    EXPECT_EQ(0, value);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,112 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <librepcb/common/utils/spatialgridindex.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class SpatialGridIndexTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(SpatialGridIndexTest, testFindByPosition)
+{
+    SpatialGridIndex<int> index(10);
+    index.insert(1, QRectF(0, 0, 5, 5));
+    index.insert(2, QRectF(3, 3, 20, 20));
+    index.insert(3, QRectF(-15, -15, 5, 5));
+    EXPECT_EQ(3, index.count());
+    EXPECT_EQ(QList<int>({1}), index.find(QPointF(1, 1)));
+    EXPECT_EQ(QList<int>({1, 2}), index.find(QPointF(4, 4)));
+    EXPECT_EQ(QList<int>({2}), index.find(QPointF(20, 20)));
+    EXPECT_EQ(QList<int>({3}), index.find(QPointF(-12, -12)));
+    EXPECT_EQ(QList<int>(), index.find(QPointF(-5, 5)));
+}
+
+TEST(SpatialGridIndexTest, testFindByRect)
+{
+    SpatialGridIndex<int> index(10);
+    index.insert(1, QRectF(0, 0, 5, 5));
+    index.insert(2, QRectF(3, 3, 20, 20));
+    index.insert(3, QRectF(-15, -15, 5, 5));
+    QList<int> items = index.find(QRectF(-1, -1, 50, 50));
+    std::sort(items.begin(), items.end());
+    EXPECT_EQ(QList<int>({1, 2}), items);
+}
+
+TEST(SpatialGridIndexTest, testFindByHugeRect)
+{
+    // must not iterate over all (empty) cells of the rect
+    SpatialGridIndex<int> index(0.001);
+    index.insert(1, QRectF(0, 0, 0.005, 0.005));
+    index.insert(2, QRectF(-1, -1, 0.001, 0.001));
+    QList<int> items = index.find(QRectF(-1e6, -1e6, 2e6, 2e6));
+    std::sort(items.begin(), items.end());
+    EXPECT_EQ(QList<int>({1, 2}), items);
+    EXPECT_EQ(QList<int>({1}), index.find(QRectF(-0.5, -0.5, 1e6, 1e6)));
+    EXPECT_EQ(QList<int>(), index.find(QRectF(10, 10, 1e6, 1e6)));
+}
+
+TEST(SpatialGridIndexTest, testMoveAndRemove)
+{
+    SpatialGridIndex<int> index(10);
+    index.insert(1, QRectF(0, 0, 5, 5));
+    index.insert(1, QRectF(100, 100, 5, 5));
+    EXPECT_EQ(1, index.count());
+    EXPECT_EQ(QList<int>(), index.find(QPointF(1, 1)));
+    EXPECT_EQ(QList<int>({1}), index.find(QPointF(101, 101)));
+    index.remove(1);
+    EXPECT_FALSE(index.contains(1));
+    EXPECT_EQ(QList<int>(), index.find(QPointF(101, 101)));
+}
+
+TEST(SpatialGridIndexTest, testLargeItem)
+{
+    SpatialGridIndex<int> index(1);
+    index.insert(1, QRectF(-1000, -1000, 2000, 2000));
+    EXPECT_EQ(QList<int>({1}), index.find(QPointF(500, -500)));
+    EXPECT_EQ(QList<int>({1}), index.find(QRectF(0, 0, 1, 1)));
+    index.remove(1);
+    EXPECT_EQ(0, index.count());
+    EXPECT_EQ(QList<int>(), index.find(QPointF(500, -500)));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
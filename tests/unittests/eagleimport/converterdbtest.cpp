@@ -0,0 +1,132 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent>
+#include <gtest/gtest.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/common/fileio/fileutils.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class ConverterDbTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("ConverterDbTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        FilePath mTempDir;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(ConverterDbTest, testUuidsArePersistent)
+{
+    FilePath dbFp = mTempDir.getPathTo("db.sqlite");
+    FilePath libFp = mTempDir.getPathTo("my library.lbr");
+    tl::optional<Uuid> symbolUuid;
+    tl::optional<Uuid> pinUuid;
+    {
+        ConverterDb db(dbFp);
+        db.setCurrentLibraryFilePath(libFp);
+        symbolUuid = db.getSymbolUuid("R {US}");
+        pinUuid = db.getSymbolPinUuid(*symbolUuid, "1");
+        EXPECT_EQ(*symbolUuid, db.getSymbolUuid("R {US}"));
+        EXPECT_NE(*symbolUuid, db.getSymbolUuid("C"));
+        EXPECT_NE(*symbolUuid, db.getPackageUuid("R {US}"));
+    } // saved by the destructor
+    ConverterDb db(dbFp);
+    db.setCurrentLibraryFilePath(libFp);
+    EXPECT_EQ(*symbolUuid, db.getSymbolUuid("R {US}"));
+    EXPECT_EQ(*pinUuid, db.getSymbolPinUuid(*symbolUuid, "1"));
+    EXPECT_EQ(QSet<QString>{"my_library.lbr"}, db.getLibraryFilenames());
+}
+
+TEST_F(ConverterDbTest, testMigrateIniFile)
+{
+    Uuid uuid = Uuid::createRandom();
+    FilePath iniFp = mTempDir.getPathTo("uuids.ini");
+    {
+        QSettings ini(iniFp.toStr(), QSettings::IniFormat);
+        ini.setValue("symbols/lib.lbr_R__U2126___", uuid.toStr());
+    }
+    ConverterDb db(iniFp);
+    EXPECT_TRUE(mTempDir.getPathTo("uuids.sqlite").isExistingFile());
+    db.setCurrentLibraryFilePath(mTempDir.getPathTo("lib.lbr"));
+    EXPECT_EQ(uuid, db.getSymbolUuid(QString("R") % QChar(0x2126)));
+}
+
+TEST_F(ConverterDbTest, testConcurrentLookups)
+{
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    FilePath libFp = mTempDir.getPathTo("lib.lbr");
+    QList<QFuture<QList<Uuid>>> futures;
+    for (int i = 0; i < 8; ++i) {
+        futures.append(QtConcurrent::run([&db, libFp]() {
+            ConverterDb libDb(db, libFp);
+            QList<Uuid> uuids;
+            for (int k = 0; k < 100; ++k) {
+                uuids.append(libDb.getSymbolUuid(QString::number(k)));
+            }
+            return uuids;
+        }));
+    }
+    QList<Uuid> expected = futures.first().result();
+    foreach (const QFuture<QList<Uuid>>& future, futures) {
+        EXPECT_EQ(expected, future.result());
+    }
+    EXPECT_EQ(100, expected.toSet().count());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace eagleimport
+} // namespace librepcb
@@ -0,0 +1,95 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/eagleimport/eaglelibraryconverter.h>
+#include <librepcb/common/fileio/fileutils.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class EagleLibraryConverterTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("EagleLibraryConverterTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        FilePath mTempDir;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(EagleLibraryConverterTest, testDuplicateFileNamesAreReported)
+{
+    FilePath src = FilePath(TEST_DATA_DIR).getPathTo("eagleimport/resistor.lbr");
+    FilePath file1 = mTempDir.getPathTo("a/resistor.lbr");
+    FilePath file2 = mTempDir.getPathTo("b/resistor.lbr");
+    FileUtils::makePath(file1.getParentDir());
+    FileUtils::makePath(file2.getParentDir());
+    FileUtils::copyFile(src, file1);
+    FileUtils::copyFile(src, file2);
+
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    EagleLibraryConverter converter(db, mTempDir.getPathTo("output"));
+    QList<EagleLibraryConverter::FileResult> results = converter.convert({file1, file2});
+    ASSERT_EQ(2, results.count());
+    EXPECT_EQ(file1, results.at(0).inputFile);
+    EXPECT_GT(results.at(0).elementCount, 0);
+    EXPECT_TRUE(results.at(0).errors.isEmpty()) << qPrintable(results.at(0).errors.join("\n"));
+    EXPECT_EQ(file2, results.at(1).inputFile);
+    EXPECT_EQ(0, results.at(1).elementCount);
+    EXPECT_EQ(1, results.at(1).errors.count());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace eagleimport
+} // namespace librepcb
@@ -0,0 +1,104 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/library/libraryelementmetadata.h>
+#include <librepcb/library/dev/device.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class LibraryElementMetadataTest : public ::testing::Test
+{
+    protected:
+        FilePath mTempDir;
+        FilePath mDeviceDir;
+        FilePath mDeviceFile;
+        Uuid mComponentUuid;
+        Uuid mPackageUuid;
+
+        LibraryElementMetadataTest() :
+            mComponentUuid(Uuid::createRandom()), mPackageUuid(Uuid::createRandom())
+        {
+            mTempDir = FilePath::getRandomTempPath();
+            Device dev(Uuid::createRandom(), Version::fromString("0.1"), "author",
+                       ElementName("test"), "", "", mComponentUuid, mPackageUuid);
+            dev.saveIntoParentDirectory(mTempDir.getPathTo("dev"));
+            mDeviceDir = mTempDir.getPathTo("dev/" % dev.getUuid().toStr());
+            mDeviceFile = mDeviceDir.getPathTo("device.lp");
+        }
+
+        virtual ~LibraryElementMetadataTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
+
+        void replaceInDeviceFile(const QByteArray& before, const QByteArray& after) {
+            QByteArray content = FileUtils::readFile(mDeviceFile);
+            ASSERT_TRUE(content.contains(before));
+            FileUtils::writeFile(mDeviceFile, content.replace(before, after));
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(LibraryElementMetadataTest, testDevice)
+{
+    LibraryElementMetadata metadata = LibraryElementMetadata::open<Device>(mDeviceDir);
+    EXPECT_EQ(mComponentUuid, metadata.getComponentUuid());
+    EXPECT_EQ(mPackageUuid, metadata.getPackageUuid());
+}
+
+TEST_F(LibraryElementMetadataTest, testDeviceWithUnexpectedNodeOrder)
+{
+    // the component and package are not part of the header anymore, so the whole file
+    // needs to be parsed
+    replaceInDeviceFile(" (component ", " (unknown_node)\n (component ");
+    LibraryElementMetadata metadata = LibraryElementMetadata::open<Device>(mDeviceDir);
+    EXPECT_EQ(mComponentUuid, metadata.getComponentUuid());
+    EXPECT_EQ(mPackageUuid, metadata.getPackageUuid());
+}
+
+TEST_F(LibraryElementMetadataTest, testDeviceWithoutComponent)
+{
+    replaceInDeviceFile(" (component ", " (foo ");
+    EXPECT_THROW(LibraryElementMetadata::open<Device>(mDeviceDir), Exception);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace library
+} // namespace librepcb
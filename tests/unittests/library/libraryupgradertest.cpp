@@ -0,0 +1,115 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/libraryupgrader.h>
+#include <librepcb/library/sym/symbol.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class LibraryUpgraderTest : public ::testing::Test
+{
+    protected:
+        FilePath mTempDir;
+        FilePath mLibDir;
+        FilePath mSymbolFile;
+
+        LibraryUpgraderTest() {
+            mTempDir = FilePath::getRandomTempPath();
+            mLibDir = mTempDir.getPathTo("test.lplib");
+            Library lib(Uuid::createRandom(), Version::fromString("0.1"), "author",
+                        ElementName("test"), "", "");
+            lib.saveTo(mLibDir);
+            Symbol sym(Uuid::createRandom(), Version::fromString("0.1"), "author",
+                       ElementName("test"), "", "");
+            sym.saveIntoParentDirectory(mLibDir.getPathTo("sym"));
+            mSymbolFile = mLibDir.getPathTo("sym/" % sym.getUuid().toStr() % "/symbol.lp");
+        }
+
+        virtual ~LibraryUpgraderTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(LibraryUpgraderTest, testUpgradedLibraryIsNotModifiedAgain)
+{
+    // make the symbol file differ from its canonical format
+    FileUtils::writeFile(mSymbolFile, FileUtils::readFile(mSymbolFile) + "\n\n");
+
+    LibraryUpgrader upgrader(mLibDir);
+    LibraryUpgrader::Result result = upgrader.upgrade(true);
+    EXPECT_EQ(2, result.elementCount); // library + symbol
+    EXPECT_EQ(1, result.modifiedCount);
+    EXPECT_EQ(0, result.ignoredCount);
+    EXPECT_TRUE(result.errors.isEmpty()) << qPrintable(result.errors.join("\n"));
+    QByteArray content = FileUtils::readFile(mSymbolFile);
+
+    // upgrading again must not modify any file
+    result = upgrader.upgrade(true);
+    EXPECT_EQ(2, result.elementCount);
+    EXPECT_EQ(0, result.modifiedCount);
+    EXPECT_TRUE(result.errors.isEmpty()) << qPrintable(result.errors.join("\n"));
+    EXPECT_EQ(content, FileUtils::readFile(mSymbolFile));
+}
+
+TEST_F(LibraryUpgraderTest, testInvalidElementIsReportedAsError)
+{
+    FileUtils::writeFile(mSymbolFile, "(librepcb_symbol");
+
+    LibraryUpgrader upgrader(mLibDir);
+    LibraryUpgrader::Result result = upgrader.upgrade(true);
+    EXPECT_EQ(2, result.elementCount);
+    EXPECT_EQ(1, result.errors.count());
+    EXPECT_EQ(QByteArray("(librepcb_symbol"), FileUtils::readFile(mSymbolFile));
+}
+
+TEST_F(LibraryUpgraderTest, testInvalidLibraryDirectory)
+{
+    LibraryUpgrader upgrader(mTempDir.getPathTo("nonexistent.lplib"));
+    LibraryUpgrader::Result result = upgrader.upgrade(true);
+    EXPECT_EQ(0, result.elementCount);
+    EXPECT_EQ(1, result.errors.count());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace library
+} // namespace librepcb
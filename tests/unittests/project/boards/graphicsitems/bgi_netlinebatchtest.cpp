@@ -0,0 +1,177 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/graphicsitems/bgi_netlinebatch.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+/**
+ * @brief The BGI_NetLineBatchTest checks the bookkeeping of net line batches
+ *
+ * The net lines are not added to the board, so they are not registered in the batches
+ * of the board itself. The test registers them manually in its own batch instead.
+ */
+class BGI_NetLineBatchTest : public ::testing::Test
+{
+    protected:
+        FilePath mProjectDir;
+        QScopedPointer<Project> mProject;
+        QScopedPointer<Board> mBoard;
+        QScopedPointer<NetClass> mNetClass;
+        QScopedPointer<NetSignal> mNetSignal;
+        QScopedPointer<BI_NetSegment> mNetSegment;
+        QScopedPointer<BI_NetPoint> mStartPoint;
+        QScopedPointer<BI_NetPoint> mEndPoint;
+        QScopedPointer<BI_NetLine> mNetLine;
+        GraphicsLayer* mLayer;
+        PositiveLength mWidth;
+
+        BGI_NetLineBatchTest() : mLayer(nullptr), mWidth(500000) {
+            mProjectDir = FilePath::getRandomTempPath().getPathTo("test project dir");
+        }
+
+        virtual ~BGI_NetLineBatchTest() {
+            QDir(mProjectDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        virtual void SetUp() override {
+            mProject.reset(Project::create(mProjectDir.getPathTo("test project.lpp")));
+            mBoard.reset(mProject->createBoard(ElementName("board")));
+            mLayer = mBoard->getLayerStack().getLayer(GraphicsLayer::sTopCopper);
+            ASSERT_TRUE(mLayer);
+            mNetClass.reset(new NetClass(mProject->getCircuit(), ElementName("default")));
+            mNetSignal.reset(new NetSignal(mProject->getCircuit(), *mNetClass,
+                                           CircuitIdentifier("GND"), false));
+            mNetSegment.reset(new BI_NetSegment(*mBoard, *mNetSignal));
+            mStartPoint.reset(new BI_NetPoint(*mNetSegment, *mLayer, Point(0, 0)));
+            mEndPoint.reset(new BI_NetPoint(*mNetSegment, *mLayer, Point(10000000, 0)));
+            mNetLine.reset(new BI_NetLine(*mStartPoint, *mEndPoint, mWidth));
+        }
+
+        virtual void TearDown() override {
+            // delete the items in reverse order of their creation, before the project
+            // directory is removed
+            mNetLine.reset();
+            mEndPoint.reset();
+            mStartPoint.reset();
+            mNetSegment.reset();
+            mNetSignal.reset();
+            mNetClass.reset();
+            mBoard.reset();
+            mProject.reset();
+        }
+
+        QRectF getLineRect(const Point& p1, const Point& p2) const {
+            const qreal margin = mWidth->toPx() / 2;
+            return QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized()
+                   .adjusted(-margin, -margin, margin, margin);
+        }
+
+        static QRectF getRectAround(const Point& pos) {
+            const qreal size = Length(100000).toPx();
+            return QRectF(pos.toPxQPointF() - QPointF(size, size), QSizeF(2*size, 2*size));
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BGI_NetLineBatchTest, testAddNetLine)
+{
+    BGI_NetLineBatch batch(*mLayer, mWidth);
+    EXPECT_EQ(0, batch.getNetLineCount());
+    EXPECT_TRUE(batch.boundingRect().isNull());
+
+    batch.addNetLine(*mNetLine);
+    EXPECT_EQ(1, batch.getNetLineCount());
+    EXPECT_EQ(getLineRect(Point(0, 0), Point(10000000, 0)), batch.boundingRect());
+    EXPECT_EQ(QList<const BI_NetLine*>{mNetLine.data()},
+              batch.getNetLinesInRect(getRectAround(Point(5000000, 0))));
+    EXPECT_TRUE(batch.getNetLinesInRect(getRectAround(Point(5000000, 5000000))).isEmpty());
+
+    batch.removeNetLine(*mNetLine);
+}
+
+TEST_F(BGI_NetLineBatchTest, testUpdateMovedNetLine)
+{
+    BGI_NetLineBatch batch(*mLayer, mWidth);
+    batch.addNetLine(*mNetLine);
+    QRectF oldRect = batch.boundingRect();
+
+    // move the net line far away (more than one grid cell of the index)
+    mStartPoint->setPosition(Point(50000000, 50000000));
+    mEndPoint->setPosition(Point(60000000, 50000000));
+    batch.updateNetLine(*mNetLine);
+    QRectF newRect = getLineRect(Point(50000000, 50000000), Point(60000000, 50000000));
+    EXPECT_EQ(1, batch.getNetLineCount());
+    EXPECT_TRUE(batch.boundingRect().contains(oldRect));
+    EXPECT_TRUE(batch.boundingRect().contains(newRect));
+
+    // the index must not contain the old position anymore
+    EXPECT_TRUE(batch.getNetLinesInRect(getRectAround(Point(5000000, 0))).isEmpty());
+    EXPECT_EQ(QList<const BI_NetLine*>{mNetLine.data()},
+              batch.getNetLinesInRect(getRectAround(Point(55000000, 50000000))));
+
+    batch.removeNetLine(*mNetLine);
+}
+
+TEST_F(BGI_NetLineBatchTest, testRemoveNetLine)
+{
+    BGI_NetLineBatch batch(*mLayer, mWidth);
+    batch.addNetLine(*mNetLine);
+    QRectF rect = batch.boundingRect();
+
+    batch.removeNetLine(*mNetLine);
+    EXPECT_EQ(0, batch.getNetLineCount());
+    EXPECT_TRUE(batch.getNetLinesInRect(rect).isEmpty());
+    EXPECT_EQ(rect, batch.boundingRect()); // only grows, see BGI_NetLineBatch
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
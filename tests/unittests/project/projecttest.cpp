@@ -22,9 +22,11 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/systeminfo.h>
 #include <librepcb/project/project.h>
 #include <librepcb/project/metadata/projectmetadata.h>
+#include <librepcb/project/schematics/schematic.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -148,6 +150,31 @@ TEST_F(ProjectTest, testIfLastModifiedDateTimeIsUpdatedOnSave)
     EXPECT_NE(datetimeAfterCreating, datetimeAfterSaving);
 }
 
+TEST_F(ProjectTest, testOpenWithCorruptSchematicFails)
+{
+    // create new project with some schematics
+    QScopedPointer<Project> project(Project::create(mProjectFile));
+    project->addSchematic(*project->createSchematic(ElementName("first")));
+    project->addSchematic(*project->createSchematic(ElementName("second")));
+    project->addSchematic(*project->createSchematic(ElementName("third")));
+    project->save(true);
+    project.reset();
+
+    // corrupt the second schematic file
+    FilePath schematicFp = mProjectDir.getPathTo("schematics/second/schematic.lp");
+    QByteArray content = FileUtils::readFile(schematicFp);
+    FileUtils::writeFile(schematicFp, "(librepcb_schematic");
+
+    // opening the project must fail without leaking or crashing, even if the other
+    // schematics are still being parsed in worker threads
+    EXPECT_THROW(project.reset(new Project(mProjectFile, false, false)), Exception);
+
+    // after fixing the file, the project can be opened again (i.e. lock was released)
+    FileUtils::writeFile(schematicFp, content);
+    project.reset(new Project(mProjectFile, false, false));
+    EXPECT_EQ(3, project->getSchematics().count());
+}
+
 TEST_F(ProjectTest, testSettersGetters)
 {
     // create new project
@@ -32,6 +32,7 @@ LIBS += \
 
 INCLUDEPATH += \
     ../../libs \
+    ../../libs/fontobene \
     ../../libs/googletest/googletest/include \
     ../../libs/googletest/googlemock/include \
     ../../libs/parseagle \
@@ -66,8 +67,15 @@ SOURCES += \
     common/attributes/attributesubstitutortest.cpp \
     common/directorylocktest.cpp \
     common/filedownloadtest.cpp \
+    common/fileio/filewritebatchtest.cpp \
     common/fileio/serializableobjectlisttest.cpp \
+    common/fileio/sexpressiontest.cpp \
     common/filepathtest.cpp \
+    common/font/compiledstrokefonttest.cpp \
+    common/graphics/graphicslayeridtest.cpp \
+    common/graphics/graphicssnapshottest.cpp \
+    common/graphics/graphicstilecachetest.cpp \
+    common/graphics/graphicsviewtest.cpp \
     common/networkrequesttest.cpp \
     common/pointtest.cpp \
     common/ratiotest.cpp \
@@ -75,14 +83,21 @@ SOURCES += \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
     common/toolboxtest.cpp \
+    common/undostacktest.cpp \
+    common/utils/spatialgridindextest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
+    eagleimport/converterdbtest.cpp \
     eagleimport/deviceconvertertest.cpp \
     eagleimport/devicesetconvertertest.cpp \
+    eagleimport/eaglelibraryconvertertest.cpp \
     eagleimport/packageconvertertest.cpp \
     eagleimport/symbolconvertertest.cpp \
+    library/libraryelementmetadatatest.cpp \
+    library/libraryupgradertest.cpp \
     main.cpp \
     project/boards/boardplanefragmentsbuildertest.cpp \
+    project/boards/graphicsitems/bgi_netlinebatchtest.cpp \
     project/projecttest.cpp \
     workspace/workspacetest.cpp \
 